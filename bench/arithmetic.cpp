@@ -0,0 +1,221 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Quantity arithmetic against the equivalent hand-written code on raw values.
+//!
+//! Every quantity case is reported relative to its raw baseline; a ratio close to 1.00x means
+//! the abstraction is free. See bench/codegen for the instruction-level comparison.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+using namespace quantify::temperature;
+
+namespace {
+  constexpr std::size_t samples = 4096;
+
+  template <typename T>
+  std::vector<T> make_values(T offset) {
+    std::vector<T> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<T>(i % 97) + offset;
+    }
+    return values;
+  }
+
+  template <typename T>
+  std::vector<T> raw_values(T offset = T{1}) {
+    return make_values<T>(offset);
+  }
+
+  template <typename U, typename T>
+  std::vector<Q<U, T>> quantities(T offset = T{1}) {
+    const auto           values = make_values<T>(offset);
+    std::vector<Q<U, T>> result(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      result[i] = values[i];
+    }
+    return result;
+  }
+
+  //! Runs `op(i)` for every sample, storing the results in `out`.
+  //! `out` is restrict-qualified so that raw and quantity loops vectorize alike.
+  template <typename Out, typename Op>
+  bench::result elementwise(std::vector<Out>& out, Op&& op) {
+    Out* __restrict dst = out.data();
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               dst[i] = op(i);
+             }
+             bench::do_not_optimize(dst);
+           })
+      .items(samples);
+  }
+
+  //! Counts the samples for which `pred(i)` holds
+  template <typename Pred>
+  bench::result count_if(Pred&& pred) {
+    return bench::run([&] {
+             std::size_t count = 0;
+             for (std::size_t i = 0; i < samples; ++i) {
+               count += pred(i) ? 1 : 0;
+             }
+             bench::do_not_optimize(count);
+           })
+      .items(samples);
+  }
+
+  //* Same unit addition
+
+  template <typename T>
+  bench::result raw_add() {
+    auto           a = raw_values<T>(), b = raw_values<T>(T{2});
+    std::vector<T> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i] + b[i]; });
+  }
+
+  template <typename T>
+  bench::result quantity_add() {
+    auto                     a = quantities<meter, T>(), b = quantities<meter, T>(T{2});
+    std::vector<Q<meter, T>> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i] + b[i]; });
+  }
+
+  //* Mixed unit addition: m + km
+
+  template <typename T>
+  bench::result raw_add_mixed() {
+    auto           a = raw_values<T>(), b = raw_values<T>(T{2});
+    std::vector<T> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i] + b[i] * T{1000}; });
+  }
+
+  template <typename T>
+  bench::result quantity_add_mixed() {
+    auto a = quantities<meter, T>();
+    auto b = quantities<kilometer, T>(T{2});
+    std::vector<Q<meter, T>> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i] + b[i]; });
+  }
+
+  //* Mixed unit comparison: m < km
+
+  template <typename T>
+  bench::result raw_compare_mixed() {
+    auto a = raw_values<T>(T{500}), b = raw_values<T>();
+    return count_if([&](std::size_t i) { return a[i] < b[i] * T{1000}; });
+  }
+
+  template <typename T>
+  bench::result quantity_compare_mixed() {
+    auto a = quantities<meter, T>(T{500});
+    auto b = quantities<kilometer, T>();
+    return count_if([&](std::size_t i) { return a[i] < b[i]; });
+  }
+
+  //* Temperature: C -> K
+
+  template <typename T>
+  bench::result raw_celsius_to_kelvin() {
+    auto           a = raw_values<T>();
+    std::vector<T> out(samples);
+    if constexpr (std::is_integral_v<T>) {
+      return elementwise(out, [&](std::size_t i) { return a[i] + 273; });
+    } else {
+      return elementwise(out, [&](std::size_t i) { return a[i] + static_cast<T>(273.15); });
+    }
+  }
+
+  template <typename T>
+  bench::result quantity_celsius_to_kelvin() {
+    auto                      a = quantities<celsius, T>();
+    std::vector<Q<kelvin, T>> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i].template as<kelvin>(); });
+  }
+
+  //* Temperature: F -> C
+
+  template <typename T>
+  bench::result raw_fahrenheit_to_celsius() {
+    auto           a = raw_values<T>();
+    std::vector<T> out(samples);
+    return elementwise(out, [&](std::size_t i) { return (a[i] - T{32}) * T{5} / T{9}; });
+  }
+
+  template <typename T>
+  bench::result quantity_fahrenheit_to_celsius() {
+    auto                       a = quantities<fahrenheit, T>();
+    std::vector<Q<celsius, T>> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i].template as<celsius>(); });
+  }
+
+  //* Composite units: km/h -> m/s
+
+  template <typename T>
+  bench::result raw_composite_as() {
+    auto           a = raw_values<T>();
+    std::vector<T> out(samples);
+    if constexpr (std::is_integral_v<T>) {
+      return elementwise(out, [&](std::size_t i) { return static_cast<T>(a[i] * 5 / 18); });
+    } else {
+      return elementwise(out, [&](std::size_t i) { return a[i] * (T{1000} / T{3600}); });
+    }
+  }
+
+  template <typename T>
+  bench::result quantity_composite_as() {
+    auto a = quantities<frac<kilometer, hours>, T>();
+    std::vector<Q<frac<meter, seconds>, T>> out(samples);
+    return elementwise(out, [&](std::size_t i) {
+      return a[i].template as<frac<meter, seconds>>();
+    });
+  }
+} // namespace
+
+//@formatter:off
+BENCH("raw add<int>")                                                { return raw_add<int>(); }
+BENCH_RELATIVE_TO("quantity add<int>", "raw add<int>")               { return quantity_add<int>(); }
+BENCH("raw add<float>")                                              { return raw_add<float>(); }
+BENCH_RELATIVE_TO("quantity add<float>", "raw add<float>")           { return quantity_add<float>(); }
+BENCH("raw add<double>")                                             { return raw_add<double>(); }
+BENCH_RELATIVE_TO("quantity add<double>", "raw add<double>")         { return quantity_add<double>(); }
+
+BENCH("raw m + km<int>")                                             { return raw_add_mixed<int>(); }
+BENCH_RELATIVE_TO("quantity m + km<int>", "raw m + km<int>")         { return quantity_add_mixed<int>(); }
+BENCH("raw m + km<float>")                                           { return raw_add_mixed<float>(); }
+BENCH_RELATIVE_TO("quantity m + km<float>", "raw m + km<float>")     { return quantity_add_mixed<float>(); }
+BENCH("raw m + km<double>")                                          { return raw_add_mixed<double>(); }
+BENCH_RELATIVE_TO("quantity m + km<double>", "raw m + km<double>")   { return quantity_add_mixed<double>(); }
+
+BENCH("raw m < km<int>")                                             { return raw_compare_mixed<int>(); }
+BENCH_RELATIVE_TO("quantity m < km<int>", "raw m < km<int>")         { return quantity_compare_mixed<int>(); }
+BENCH("raw m < km<float>")                                           { return raw_compare_mixed<float>(); }
+BENCH_RELATIVE_TO("quantity m < km<float>", "raw m < km<float>")     { return quantity_compare_mixed<float>(); }
+BENCH("raw m < km<double>")                                          { return raw_compare_mixed<double>(); }
+BENCH_RELATIVE_TO("quantity m < km<double>", "raw m < km<double>")   { return quantity_compare_mixed<double>(); }
+
+BENCH("raw C -> K<int>")                                             { return raw_celsius_to_kelvin<int>(); }
+BENCH_RELATIVE_TO("quantity C -> K<int>", "raw C -> K<int>")         { return quantity_celsius_to_kelvin<int>(); }
+BENCH("raw C -> K<float>")                                           { return raw_celsius_to_kelvin<float>(); }
+BENCH_RELATIVE_TO("quantity C -> K<float>", "raw C -> K<float>")     { return quantity_celsius_to_kelvin<float>(); }
+BENCH("raw C -> K<double>")                                          { return raw_celsius_to_kelvin<double>(); }
+BENCH_RELATIVE_TO("quantity C -> K<double>", "raw C -> K<double>")   { return quantity_celsius_to_kelvin<double>(); }
+
+BENCH("raw F -> C<int>")                                             { return raw_fahrenheit_to_celsius<int>(); }
+BENCH_RELATIVE_TO("quantity F -> C<int>", "raw F -> C<int>")         { return quantity_fahrenheit_to_celsius<int>(); }
+BENCH("raw F -> C<float>")                                           { return raw_fahrenheit_to_celsius<float>(); }
+BENCH_RELATIVE_TO("quantity F -> C<float>", "raw F -> C<float>")     { return quantity_fahrenheit_to_celsius<float>(); }
+BENCH("raw F -> C<double>")                                          { return raw_fahrenheit_to_celsius<double>(); }
+BENCH_RELATIVE_TO("quantity F -> C<double>", "raw F -> C<double>")   { return quantity_fahrenheit_to_celsius<double>(); }
+
+BENCH("raw km/h -> m/s<int>")                                        { return raw_composite_as<int>(); }
+BENCH_RELATIVE_TO("quantity km/h -> m/s<int>", "raw km/h -> m/s<int>")       { return quantity_composite_as<int>(); }
+BENCH("raw km/h -> m/s<float>")                                      { return raw_composite_as<float>(); }
+BENCH_RELATIVE_TO("quantity km/h -> m/s<float>", "raw km/h -> m/s<float>")   { return quantity_composite_as<float>(); }
+BENCH("raw km/h -> m/s<double>")                                     { return raw_composite_as<double>(); }
+BENCH_RELATIVE_TO("quantity km/h -> m/s<double>", "raw km/h -> m/s<double>") { return quantity_composite_as<double>(); }
+//@formatter:on
@@ -0,0 +1,69 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Conversions from `std::chrono` durations into quantities, against going through `count()` and
+//! a manual conversion into double, for latencies measured in clock ticks.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::time;
+
+namespace {
+  constexpr std::size_t samples = 1 << 20;
+
+  const std::vector<std::chrono::nanoseconds> latencies = [] {
+    std::vector<std::chrono::nanoseconds> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = std::chrono::nanoseconds{static_cast<std::int64_t>(i % 10007) * 13};
+    }
+    return values;
+  }();
+
+  constexpr double payload_bytes = samples * sizeof(std::int64_t);
+
+  template <typename Convert>
+  bench::result conversion(Convert&& convert) {
+    return bench::run([&] {
+             for (const auto& latency: latencies) {
+               bench::do_not_optimize(convert(latency));
+             }
+           })
+      .items(samples)
+      .bytes(payload_bytes);
+  }
+
+  template <typename Accumulate>
+  bench::result accumulation(Accumulate&& accumulate) {
+    return bench::run([&] { bench::do_not_optimize(accumulate()); })
+      .items(samples)
+      .bytes(payload_bytes);
+  }
+} // namespace
+
+//@formatter:off
+BENCH("manual count() into double s")                          { return conversion([](auto d) { return static_cast<double>(d.count()) * 1e-9; }); }
+BENCH_RELATIVE_TO("Q<seconds, double>", "manual count() into double s") { return conversion([](auto d) { return Q<seconds, double>{d}; }); }
+BENCH("manual count() into int64 ns")                          { return conversion([](auto d) { return d.count(); }); }
+BENCH_RELATIVE_TO("Q<nanoseconds, int64>", "manual count() into int64 ns") { return conversion([](auto d) { return Q<nanoseconds, std::int64_t>{d}; }); }
+BENCH("manual sum of count()")                                 {
+  return accumulation([] {
+    std::int64_t total = 0;
+    for (const auto& latency: latencies) {
+      total += latency.count();
+    }
+    return total;
+  });
+}
+BENCH_RELATIVE_TO("Q<nanoseconds, int64> += duration", "manual sum of count()") {
+  return accumulation([] {
+    Q<nanoseconds, std::int64_t> total{};
+    for (const auto& latency: latencies) {
+      total += Q<nanoseconds, std::int64_t>{latency};
+    }
+    return total;
+  });
+}
+//@formatter:on
@@ -0,0 +1,98 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Pairs of functions whose optimized code must be identical.
+//!
+//! Every `raw_<case>` function is hand-written arithmetic on plain values, and the matching
+//! `quantity_<case>` function does the same through quantities. Both take and return plain
+//! values so that they share a calling convention. cmake/codegen_check.cmake disassembles the
+//! object file and flags every pair whose instructions differ.
+//!
+//! Raw temperature conversions are written the way one would by hand. Quantities round integer
+//! temperatures exactly from the offset of 273.15 K or 160/9 C, and fold F -> C into a single
+//! multiplication and addition, so those pairs are expected to differ by that work.
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+using namespace quantify::temperature;
+
+using m_s  = frac<meter, seconds>;
+using km_h = frac<kilometer, hours>;
+
+#define CODEGEN_PAIRS(T)                                                                           \
+  T raw_add_##T(T a, T b) {                                                                        \
+    return a + b;                                                                                  \
+  }                                                                                                \
+  T quantity_add_##T(T a, T b) {                                                                   \
+    return (Q<meter, T>{a} + Q<meter, T>{b}).value;                                                \
+  }                                                                                                \
+                                                                                                   \
+  T raw_add_mixed_##T(T a, T b) {                                                                  \
+    return a + b * T{1000};                                                                        \
+  }                                                                                                \
+  T quantity_add_mixed_##T(T a, T b) {                                                             \
+    return (Q<meter, T>{a} + Q<kilometer, T>{b}).value;                                            \
+  }                                                                                                \
+                                                                                                   \
+  bool raw_less_##T(T a, T b) {                                                                    \
+    return a < b;                                                                                  \
+  }                                                                                                \
+  bool quantity_less_##T(T a, T b) {                                                               \
+    return Q<meter, T>{a} < Q<meter, T>{b};                                                        \
+  }                                                                                                \
+                                                                                                   \
+  T raw_scale_##T(T a, T b) {                                                                      \
+    return a * b;                                                                                  \
+  }                                                                                                \
+  T quantity_scale_##T(T a, T b) {                                                                 \
+    return (Q<meter, T>{a} * b).value;                                                             \
+  }                                                                                                \
+                                                                                                   \
+  T raw_celsius_to_kelvin_##T(T a) {                                                               \
+    if constexpr (std::is_integral_v<T>) {                                                         \
+      return a + 273;                                                                              \
+    } else {                                                                                       \
+      return a + static_cast<T>(273.15);                                                           \
+    }                                                                                              \
+  }                                                                                                \
+  T quantity_celsius_to_kelvin_##T(T a) {                                                          \
+    return Q<celsius, T>{a}.template as<kelvin>().value;                                           \
+  }                                                                                                \
+                                                                                                   \
+  T raw_fahrenheit_to_celsius_##T(T a) {                                                           \
+    return (a - T{32}) * T{5} / T{9};                                                              \
+  }                                                                                                \
+  T quantity_fahrenheit_to_celsius_##T(T a) {                                                      \
+    return Q<fahrenheit, T>{a}.template as<celsius>().value;                                       \
+  }
+
+extern "C" {
+  CODEGEN_PAIRS(int)
+  CODEGEN_PAIRS(float)
+  CODEGEN_PAIRS(double)
+
+  // Composite unit conversion, km/h -> m/s. The factor is 5/18.
+  int raw_composite_as_int(int a) {
+    return static_cast<int>(static_cast<long long>(a) * 5 / 18);
+  }
+  int quantity_composite_as_int(int a) {
+    return Q<km_h, int>{a}.as<m_s>().value;
+  }
+
+  float raw_composite_as_float(float a) {
+    return a * (1000.0f / 3600.0f);
+  }
+  float quantity_composite_as_float(float a) {
+    return Q<km_h, float>{a}.as<m_s>().value;
+  }
+
+  double raw_composite_as_double(double a) {
+    return a * (1000.0 / 3600.0);
+  }
+  double quantity_composite_as_double(double a) {
+    return Q<km_h, double>{a}.as<m_s>().value;
+  }
+}
@@ -0,0 +1,180 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef QUANTIFY_BENCH_STRUCTURE_H
+#define QUANTIFY_BENCH_STRUCTURE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <source_location>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench {
+  //! Prevents the compiler from optimizing away the computation of `value`.
+  template <typename T>
+  inline void do_not_optimize(T const& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+  }
+
+  template <typename T>
+  inline void do_not_optimize(T& value) {
+    asm volatile("" : "+r,m"(value) : : "memory");
+  }
+
+  struct result {
+    double        ns_per_op  = 0.0;
+    std::uint64_t iterations = 0;
+    //! Amount of items processed by one operation, used to report throughput.
+    double        items_per_op = 1.0;
+    //! Amount of bytes processed by one operation, used to report bandwidth.
+    double        bytes_per_op = 0.0;
+
+    result& items(double n) {
+      items_per_op = n;
+      return *this;
+    }
+
+    result& bytes(double n) {
+      bytes_per_op = n;
+      return *this;
+    }
+  };
+
+  //! Minimum wall time spent on each measurement
+  inline std::chrono::nanoseconds min_time = std::chrono::milliseconds{200};
+
+  /*! Runs `op` repeatedly, doubling the amount of iterations until a measurement takes at
+   *  least `min_time`, and reports the average time spent per call.
+   */
+  template <typename Op>
+  result run(Op&& op) {
+    using clock = std::chrono::steady_clock;
+
+    std::uint64_t iterations = 1;
+    while (true) {
+      const auto start = clock::now();
+      for (std::uint64_t i = 0; i < iterations; ++i) {
+        op();
+      }
+      const auto elapsed = clock::now() - start;
+
+      if (elapsed >= min_time || iterations >= (1ULL << 40)) {
+        const auto ns = std::chrono::duration<double, std::nano>(elapsed).count();
+        return {ns / static_cast<double>(iterations), iterations};
+      }
+      iterations *= 2;
+    }
+  }
+} // namespace bench
+
+class bench_case_t;
+
+class bench_case_list_t {
+public:
+  std::vector<bench_case_t*> bench_cases{};
+};
+
+inline bench_case_list_t BENCHMARKS{};
+
+class bench_case_t {
+public:
+  std::string                    name;
+  std::source_location           location;
+  std::function<bench::result()> body;
+  //! Name of the case this one is reported relative to, if any
+  std::string                    baseline;
+
+  bench_case_t(
+    const std::string&             name_,
+    const std::source_location     location_,
+    std::function<bench::result()> body_,
+    const std::string&             baseline_ = ""
+  )
+    : name(name_),
+      location(location_),
+      body(std::move(body_)),
+      baseline(baseline_) {
+    BENCHMARKS.bench_cases.push_back(this);
+  }
+};
+
+#define BENCH_ID       bench_case_
+#define BENCH_BLOCK_ID bench_case_block_
+#define BENCH_ID_NUM   __LINE__
+#define BENCH_CONCAT_IMPL(A, B) A##B
+#define BENCH_CONCAT(A, B)      BENCH_CONCAT_IMPL(A, B)
+
+#define __BENCH_DECL(NAME, BASELINE, ID)                                                           \
+  bench::result BENCH_CONCAT(BENCH_BLOCK_ID, ID)();                                                \
+  bench_case_t  BENCH_CONCAT(BENCH_ID, ID){                                                        \
+    NAME,                                                                                         \
+    std::source_location::current(),                                                              \
+    []() { return BENCH_CONCAT(BENCH_BLOCK_ID, ID)(); },                                          \
+    BASELINE                                                                                      \
+  };                                                                                               \
+  bench::result BENCH_CONCAT(BENCH_BLOCK_ID, ID)()
+
+#define BENCH(NAME) __BENCH_DECL(NAME, "", BENCH_ID_NUM)
+
+//! Declares a benchmark that is reported relative to the benchmark named `BASELINE`
+#define BENCH_RELATIVE_TO(NAME, BASELINE) __BENCH_DECL(NAME, BASELINE, BENCH_ID_NUM)
+
+inline void report(
+  const bench_case_t& bench_case, const bench::result& r, const bench::result* baseline = nullptr
+) {
+  std::cout << std::left << std::setw(48) << bench_case.name << std::right << std::fixed
+            << std::setprecision(3) << std::setw(12) << r.ns_per_op << " ns/op";
+  if (r.items_per_op != 1.0) {
+    std::cout << std::setw(12) << (r.ns_per_op / r.items_per_op) << " ns/item";
+  }
+  if (r.bytes_per_op > 0.0) {
+    std::cout << std::setw(10) << (r.bytes_per_op / r.ns_per_op) << " GB/s";
+  }
+  if (baseline != nullptr) {
+    std::cout << std::setw(10) << std::setprecision(2) << (r.ns_per_op / baseline->ns_per_op)
+              << "x " << bench_case.baseline;
+  }
+  std::cout << std::endl;
+}
+
+/*! Runs every benchmark in the file, or only the one named by the first argument.
+ *
+ * Cases declared with BENCH_RELATIVE_TO also report their time as a multiple of their
+ * baseline, which is run first if it has not been already.
+ */
+int main(int argc, char* argv[]) {
+  std::map<std::string, bench::result> results{};
+
+  std::function<const bench::result&(const bench_case_t&)> run_case;
+  run_case = [&](const bench_case_t& bench_case) -> const bench::result& {
+    if (auto it = results.find(bench_case.name); it != results.end()) {
+      return it->second;
+    }
+    const bench::result* baseline = nullptr;
+    for (const auto* other: BENCHMARKS.bench_cases) {
+      if (!bench_case.baseline.empty() && other->name == bench_case.baseline) {
+        baseline = &run_case(*other);
+        break;
+      }
+    }
+    const auto& r = results.try_emplace(bench_case.name, bench_case.body()).first->second;
+    report(bench_case, r, baseline);
+    return r;
+  };
+
+  for (const auto* bench_case: BENCHMARKS.bench_cases) {
+    if (argc == 2 && bench_case->name != argv[1]) {
+      continue;
+    }
+    run_case(*bench_case);
+  }
+  return 0;
+}
+
+#endif // QUANTIFY_BENCH_STRUCTURE_H
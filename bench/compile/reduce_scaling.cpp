@@ -0,0 +1,56 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Compile-time benchmark for unit reduction.
+//!
+//! Builds a telescoping product of QUANTIFY_BENCH_TERMS fractions,
+//! `(u0/u1) * (u1/u2) * ... * (uN-1/uN)`, reduces it and checks it against an equivalent
+//! expression written in a different order. The build system compiles this file once per size
+//! and reports the time each one takes.
+
+import quantify;
+
+#ifndef QUANTIFY_BENCH_TERMS
+#define QUANTIFY_BENCH_TERMS 16
+#endif
+
+using namespace quantify;
+
+namespace {
+  using pool = std::tuple<
+    distance::meter,
+    time::seconds,
+    mass::kilograms,
+    electric_current::ampere,
+    substance::mole,
+    light_intensity::candela,
+    temperature::kelvin>;
+
+  template <std::size_t I>
+  using unit_at = std::tuple_element_t<I % std::tuple_size_v<pool>, pool>;
+
+  template <std::size_t... I>
+  auto telescoping(std::index_sequence<I...>) -> mul<frac<unit_at<I>, unit_at<I + 1>>...>;
+
+  template <std::size_t... I>
+  auto reversed(std::index_sequence<I...>)
+    -> frac<mul<unit_at<sizeof...(I) - I - 1>...>, mul<unit_at<sizeof...(I) - I>...>>;
+
+  constexpr std::size_t terms = QUANTIFY_BENCH_TERMS;
+
+  using expr  = decltype(telescoping(std::make_index_sequence<terms>{}));
+  using other = decltype(reversed(std::make_index_sequence<terms>{}));
+
+  using expected = std::conditional_t<
+    terms % std::tuple_size_v<pool> == 0,
+    no_unit,
+    frac<unit_at<0>, unit_at<terms>>>;
+} // namespace
+
+static_assert(std::is_same_v<reduce<expr>, expected>);
+static_assert(std::is_same_v<reduce<reduce<expr>>, reduce<expr>>);
+static_assert(CompareScales<typename expr::scale, typename other::scale>);
+
+int main() {
+  return 0;
+}
@@ -0,0 +1,64 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::temperature;
+
+namespace {
+  constexpr std::size_t samples = 10'000'000;
+
+  template <typename U_FROM, typename U_TO, typename T>
+  bench::result scalar_loop() {
+    std::vector<Q<U_FROM, T>> in(samples, T{1});
+    std::vector<Q<U_TO, T>>   out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = in[i].template as<U_TO>();
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(2.0 * samples * sizeof(T));
+  }
+
+  template <typename U_FROM, typename U_TO, typename T>
+  bench::result batch() {
+    std::vector<Q<U_FROM, T>> in(samples, T{1});
+    std::vector<Q<U_TO, T>>   out(samples);
+    return bench::run([&] {
+             const auto converted = convert<U_TO>(std::span{in}, std::span{out});
+             bench::do_not_optimize(converted.has_value());
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(2.0 * samples * sizeof(T));
+  }
+
+  template <typename U_FROM, typename U_TO, typename T>
+  bench::result batch_in_place() {
+    std::vector<Q<U_FROM, T>> buffer(samples, T{1});
+    return bench::run([&] {
+             auto view = convert_in_place<U_TO>(std::span{buffer});
+             bench::do_not_optimize(view.data());
+           })
+      .items(samples)
+      .bytes(2.0 * samples * sizeof(T));
+  }
+} // namespace
+
+BENCH("mm -> m   (double, as<> loop)") { return scalar_loop<millimeter, meter, double>(); }
+BENCH("mm -> m   (double, convert)") { return batch<millimeter, meter, double>(); }
+BENCH("mm -> m   (double, convert_in_place)") { return batch_in_place<millimeter, meter, double>(); }
+BENCH("mm -> m   (float, as<> loop)") { return scalar_loop<millimeter, meter, float>(); }
+BENCH("mm -> m   (float, convert)") { return batch<millimeter, meter, float>(); }
+BENCH("C -> K    (double, as<> loop)") { return scalar_loop<celsius, kelvin, double>(); }
+BENCH("C -> K    (double, convert)") { return batch<celsius, kelvin, double>(); }
+BENCH("C -> K    (float, as<> loop)") { return scalar_loop<celsius, kelvin, float>(); }
+BENCH("C -> K    (float, convert)") { return batch<celsius, kelvin, float>(); }
+BENCH("mC -> F   (double, as<> loop)") { return scalar_loop<millicelsius, fahrenheit, double>(); }
+BENCH("mC -> F   (double, convert)") { return batch<millicelsius, fahrenheit, double>(); }
@@ -0,0 +1,97 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Run-time dimensioned quantities against static quantities of the same units.
+//!
+//! A `dynamic_quantity<T>` stores a 64-bit dimension and a 2x64-bit factor next to its value,
+//! so it is 24 bytes larger than `quantity<U, T>`; the bandwidth column reflects that footprint.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+
+static_assert(sizeof(dynamic_quantity<double>) == sizeof(Q<meter, double>) + 24);
+
+namespace {
+  constexpr std::size_t samples = 4096;
+
+  template <typename U>
+  std::vector<Q<U, double>> statics(double offset = 1.0) {
+    std::vector<Q<U, double>> result(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      result[i] = static_cast<double>(i % 97) + offset;
+    }
+    return result;
+  }
+
+  template <typename U>
+  std::vector<dynamic_quantity<double>> dynamics(double offset = 1.0) {
+    const auto                            values = statics<U>(offset);
+    std::vector<dynamic_quantity<double>> result(values.begin(), values.end());
+    return result;
+  }
+
+  //! Runs `op(i)` for every sample, storing the results in `out`
+  template <typename Out, typename Op>
+  bench::result elementwise(std::vector<Out>& out, Op&& op) {
+    Out* __restrict dst = out.data();
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               dst[i] = op(i);
+             }
+             bench::do_not_optimize(dst);
+           })
+      .items(samples)
+      .bytes(static_cast<double>(3 * sizeof(Out) * samples));
+  }
+
+  template <typename UA, typename UB, typename Op>
+  bench::result static_case(Op&& op) {
+    auto a = statics<UA>(), b = statics<UB>(2.0);
+    std::vector<decltype(op(a[0], b[0]))> out(samples);
+    return elementwise(out, [&](std::size_t i) { return op(a[i], b[i]); });
+  }
+
+  template <typename UA, typename UB, typename Op>
+  bench::result dynamic_case(Op&& op) {
+    auto a = dynamics<UA>(), b = dynamics<UB>(2.0);
+    std::vector<decltype(op(a[0], b[0]))> out(samples);
+    return elementwise(out, [&](std::size_t i) { return op(a[i], b[i]); });
+  }
+
+  constexpr auto add      = [](const auto& a, const auto& b) { return a + b; };
+  constexpr auto multiply = [](const auto& a, const auto& b) { return a * b; };
+  constexpr auto divide   = [](const auto& a, const auto& b) { return a / b; };
+  constexpr auto less     = [](const auto& a, const auto& b) { return static_cast<char>(a < b); };
+
+  bench::result dynamic_to_static() {
+    auto                          a = dynamics<kilometer>();
+    std::vector<Q<meter, double>> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i].as<meter>().value_or(0.0); });
+  }
+
+  bench::result static_to_static() {
+    auto                          a = statics<kilometer>();
+    std::vector<Q<meter, double>> out(samples);
+    return elementwise(out, [&](std::size_t i) { return a[i].as<meter>(); });
+  }
+} // namespace
+
+//@formatter:off
+BENCH("static m + m")                                       { return static_case<meter, meter>(add); }
+BENCH_RELATIVE_TO("dynamic m + m", "static m + m")          { return dynamic_case<meter, meter>(add); }
+BENCH("static m + km")                                      { return static_case<meter, kilometer>(add); }
+BENCH_RELATIVE_TO("dynamic m + km", "static m + km")        { return dynamic_case<meter, kilometer>(add); }
+BENCH("static m < km")                                      { return static_case<meter, kilometer>(less); }
+BENCH_RELATIVE_TO("dynamic m < km", "static m < km")        { return dynamic_case<meter, kilometer>(less); }
+BENCH("static km * s")                                      { return static_case<kilometer, seconds>(multiply); }
+BENCH_RELATIVE_TO("dynamic km * s", "static km * s")        { return dynamic_case<kilometer, seconds>(multiply); }
+BENCH("static km / hours")                                  { return static_case<kilometer, hours>(divide); }
+BENCH_RELATIVE_TO("dynamic km / hours", "static km / hours") { return dynamic_case<kilometer, hours>(divide); }
+BENCH("static km -> m")                                     { return static_to_static(); }
+BENCH_RELATIVE_TO("dynamic km -> m", "static km -> m")      { return dynamic_to_static(); }
+//@formatter:on
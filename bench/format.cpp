@@ -0,0 +1,71 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+
+namespace {
+  Q<meter, double> distance_sample{1234.5678};
+  Q<meter, int>    integer_sample{1234};
+} // namespace
+
+BENCH("to_string") {
+  return bench::run([] {
+    auto str = distance_sample.to_string();
+    bench::do_not_optimize(str);
+  });
+}
+
+BENCH("std::format") {
+  return bench::run([] {
+    auto str = std::format("{}", distance_sample);
+    bench::do_not_optimize(str);
+  });
+}
+
+BENCH("std::format_to (stack buffer)") {
+  return bench::run([] {
+    char buffer[64];
+    auto end = std::format_to(buffer, "{}", distance_sample);
+    bench::do_not_optimize(buffer);
+    bench::do_not_optimize(end);
+  });
+}
+
+BENCH("std::format_to (precision, no unit)") {
+  return bench::run([] {
+    char buffer[64];
+    auto end = std::format_to(buffer, "{:.3fn}", distance_sample);
+    bench::do_not_optimize(buffer);
+    bench::do_not_optimize(end);
+  });
+}
+
+BENCH("std::format_to (inline conversion)") {
+  return bench::run([] {
+    char buffer[64];
+    auto end = std::format_to(buffer, "{:.3f}", format_as<kilometer>(distance_sample));
+    bench::do_not_optimize(buffer);
+    bench::do_not_optimize(end);
+  });
+}
+
+BENCH("std::format_to (int)") {
+  return bench::run([] {
+    char buffer[64];
+    auto end = std::format_to(buffer, "{}", integer_sample);
+    bench::do_not_optimize(buffer);
+    bench::do_not_optimize(end);
+  });
+}
+
+BENCH("to_string (int)") {
+  return bench::run([] {
+    auto str = integer_sample.to_string();
+    bench::do_not_optimize(str);
+  });
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Formula kernels against the same formula written with quantity operators and with raw
+//! doubles, for the work `F * d` of many samples given in newtons and millimeters.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::force;
+using namespace quantify::energy;
+
+namespace {
+  constexpr std::size_t samples = 1 << 20;
+
+  namespace work = mechanics::work;
+
+  template <typename U>
+  std::vector<Q<U, double>> inputs(double offset) {
+    std::vector<Q<U, double>> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<double>(i % 1000) / 8.0 + offset;
+    }
+    return values;
+  }
+
+  const auto forces    = inputs<newtons>(1.0);
+  const auto distances = inputs<millimeter>(2.0);
+
+  constexpr double payload_bytes = 3.0 * samples * sizeof(double);
+
+  bench::result raw_loop() {
+    std::vector<double> out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = forces[i].value * distances[i].value / 1000.0;
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(payload_bytes);
+  }
+
+  bench::result operator_loop() {
+    std::vector<Q<joule, double>> out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = (forces[i] * distances[i]).as<joule>();
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(payload_bytes);
+  }
+
+  bench::result kernel_loop() {
+    constexpr auto kernel = work::isolate<work::work>::with<work::force, work::distance>;
+    std::vector<Q<joule, double>> out(samples);
+    return bench::run([&] {
+             const auto written = kernel.eval_into(out, forces, distances);
+             bench::do_not_optimize(written.has_value());
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(payload_bytes);
+  }
+} // namespace
+
+//@formatter:off
+BENCH("raw double N * mm -> J")                                        { return raw_loop(); }
+BENCH_RELATIVE_TO("Q operators N * mm -> J", "raw double N * mm -> J") { return operator_loop(); }
+BENCH_RELATIVE_TO("formula kernel eval_into", "raw double N * mm -> J") { return kernel_loop(); }
+//@formatter:on
@@ -0,0 +1,47 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Cost of counting implicit conversions, for a loop accumulating kilometers into meters. Build
+//! with and without `QUANTIFY_INSTRUMENT_CONVERSIONS` to compare, the loop without conversions is
+//! never counted.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+
+namespace {
+  constexpr std::size_t samples = 1 << 20;
+
+  const std::vector<Q<kilometer, double>> legs = [] {
+    std::vector<Q<kilometer, double>> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<double>(i % 1000) / 8.0;
+    }
+    return values;
+  }();
+
+  template <typename U>
+  bench::result accumulation() {
+    return bench::run([] {
+             Q<U, double> total{};
+             for (const auto& leg: legs) {
+               total += leg;
+             }
+             bench::do_not_optimize(total);
+           })
+      .items(samples)
+      .bytes(static_cast<double>(samples * sizeof(double)));
+  }
+
+  constexpr const char* converting_loop = conversion_instrumentation_enabled
+                                            ? "km += into m (instrumented)"
+                                            : "km += into m (not instrumented)";
+} // namespace
+
+//@formatter:off
+BENCH("km += into km")                                 { return accumulation<kilometer>(); }
+BENCH_RELATIVE_TO(converting_loop, "km += into km")    { return accumulation<meter>(); }
+//@formatter:on
@@ -0,0 +1,130 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Lazy expressions against the eager operators, for an element-wise formula over ranges and
+//! for the heat balance of the "Example" test evaluated over many inputs.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+using namespace quantify::mass;
+using namespace quantify::temperature;
+
+namespace {
+  constexpr std::size_t samples = 1 << 16;
+
+  template <typename U>
+  std::vector<Q<U, double>> inputs(double offset) {
+    std::vector<Q<U, double>> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<double>(i % 97) + offset;
+    }
+    return values;
+  }
+
+  using speed = frac<meter, seconds>;
+
+  const auto a = inputs<kilometer>(1.0);
+  const auto b = inputs<meter>(2.0);
+  const auto t = inputs<minutes>(3.0);
+
+  //! speed = (a + b) / t, with a in km, b in m, t in min
+  bench::result eager_speed() {
+    std::vector<Q<speed, double>> out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = ((a[i] + b[i]) / t[i]).as<speed>();
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(static_cast<double>(4 * sizeof(double) * samples));
+  }
+
+  bench::result lazy_speed() {
+    std::vector<Q<speed, double>> out(samples);
+    return bench::run([&] {
+             const auto written = ((lazy::of(a) + lazy::of(b)) / lazy::of(t)).eval_into(out);
+             bench::do_not_optimize(written.has_value());
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(static_cast<double>(4 * sizeof(double) * samples));
+  }
+
+  using volume = mul<meter, meter, meter>;
+
+  const auto c = inputs<centimeter>(4.0);
+
+  //! volume = a * b * c, with a in km, b in m, c in cm, and the volume in m^3
+  bench::result eager_volume() {
+    std::vector<Q<volume, double>> out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = (a[i] * b[i] * c[i]).as<volume>();
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(static_cast<double>(4 * sizeof(double) * samples));
+  }
+
+  bench::result lazy_volume() {
+    std::vector<Q<volume, double>> out(samples);
+    return bench::run([&] {
+             const auto written = (lazy::of(a) * lazy::of(b) * lazy::of(c)).eval_into(out);
+             bench::do_not_optimize(written.has_value());
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(static_cast<double>(4 * sizeof(double) * samples));
+  }
+
+  using joules   = frac<mul<kilograms, meter, meter>, mul<seconds, seconds>>;
+  using flow     = frac<kilograms, seconds>;
+  using capacity = frac<joules, mul<kilograms, kelvin>>;
+
+  const auto T_ci = inputs<kelvin>(290.0);
+  const auto T_hi = inputs<kelvin>(370.0);
+  const auto m_h  = inputs<flow>(0.1);
+  const Q<kelvin, double>   T_ho{333};
+  const Q<flow, double>     m_c{0.2};
+  const Q<capacity, double> cp_w{4178}, cp_oil{2131};
+
+  //! T_co = T_ci + m_h * cp_oil * (T_hi - T_ho) / (m_c * cp_w), with T_co in celsius
+  template <typename Formula>
+  bench::result heat_balance(Formula&& formula) {
+    std::vector<Q<celsius, double>> out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = formula(i);
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes(static_cast<double>(4 * sizeof(double) * samples));
+  }
+} // namespace
+
+//@formatter:off
+BENCH("eager (a + b) / t")                                { return eager_speed(); }
+BENCH_RELATIVE_TO("lazy (a + b) / t", "eager (a + b) / t") { return lazy_speed(); }
+BENCH("eager a * b * c")                                  { return eager_volume(); }
+BENCH_RELATIVE_TO("lazy a * b * c", "eager a * b * c")    { return lazy_volume(); }
+BENCH("eager heat balance")                               {
+  return heat_balance([](std::size_t i) {
+    return (T_ci[i] + m_h[i] * cp_oil * (T_hi[i] - T_ho) / (m_c * cp_w)).as<celsius>();
+  });
+}
+BENCH_RELATIVE_TO("lazy heat balance", "eager heat balance") {
+  return heat_balance([](std::size_t i) {
+    const Q<kelvin, double> T_co =
+      lazy::of(T_ci[i]) + lazy::of(m_h[i]) * cp_oil * (T_hi[i] - T_ho) / (m_c * cp_w);
+    return T_co.as<celsius>();
+  });
+}
+//@formatter:on
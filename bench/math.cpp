@@ -0,0 +1,106 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Unit-aware math functions against the same `<cmath>` calls on raw doubles, including the
+//! conversions a mix of units needs, which the quantity versions fold into a single constant.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::force;
+using namespace quantify::energy;
+
+namespace {
+  constexpr std::size_t samples = 1 << 20;
+
+  template <typename U>
+  std::vector<Q<U, double>> inputs(double offset) {
+    std::vector<Q<U, double>> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<double>(i % 1000) / 8.0 + offset;
+    }
+    return values;
+  }
+
+  const auto areas  = inputs<mul<meter, kilometer>>(1.0);
+  const auto meters = inputs<meter>(2.0);
+  const auto kms    = inputs<kilometer>(3.0);
+  const auto forces = inputs<newtons>(4.0);
+  const auto joules = inputs<joule>(5.0);
+
+  template <typename Q, typename F>
+  bench::result loop(F&& f, double operands) {
+    std::vector<Q> out(samples);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               out[i] = f(i);
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(samples)
+      .bytes((operands + 1.0) * samples * sizeof(double));
+  }
+
+  bench::result raw_sqrt() {
+    return loop<double>([](std::size_t i) { return std::sqrt(areas[i].value * 1000.0); }, 1);
+  }
+
+  bench::result quantity_sqrt() {
+    return loop<Q<meter, double>>([](std::size_t i) { return sqrt(areas[i]); }, 1);
+  }
+
+  bench::result raw_pow() {
+    return loop<double>(
+      [](std::size_t i) {
+        const double x = meters[i].value;
+        return x * x * x;
+      },
+      1
+    );
+  }
+
+  bench::result quantity_pow() {
+    return loop<Q<mul<meter, meter, meter>, double>>(
+      [](std::size_t i) { return pow<3>(meters[i]); }, 1
+    );
+  }
+
+  bench::result raw_hypot() {
+    return loop<double>(
+      [](std::size_t i) { return std::hypot(meters[i].value, kms[i].value * 1000.0); }, 2
+    );
+  }
+
+  bench::result quantity_hypot() {
+    return loop<Q<meter, double>>([](std::size_t i) { return hypot(meters[i], kms[i]); }, 2);
+  }
+
+  bench::result raw_fma() {
+    return loop<double>(
+      [](std::size_t i) {
+        return std::fma(forces[i].value, kms[i].value, joules[i].value / 1000.0);
+      },
+      3
+    );
+  }
+
+  bench::result quantity_fma() {
+    return loop<Q<mul<newtons, kilometer>, double>>(
+      [](std::size_t i) { return fma(forces[i], kms[i], joules[i]); }, 3
+    );
+  }
+} // namespace
+
+//@formatter:off
+BENCH("raw std::sqrt(m * km * 1000)")                                       { return raw_sqrt(); }
+BENCH_RELATIVE_TO("sqrt(Q<m * km>) -> Q<m>", "raw std::sqrt(m * km * 1000)") { return quantity_sqrt(); }
+BENCH("raw x * x * x")                                                      { return raw_pow(); }
+BENCH_RELATIVE_TO("pow<3>(Q<m>)", "raw x * x * x")                          { return quantity_pow(); }
+BENCH("raw std::hypot(m, km * 1000)")                                       { return raw_hypot(); }
+BENCH_RELATIVE_TO("hypot(Q<m>, Q<km>)", "raw std::hypot(m, km * 1000)")     { return quantity_hypot(); }
+BENCH("raw std::fma(N, km, J / 1000)")                                      { return raw_fma(); }
+BENCH_RELATIVE_TO("fma(Q<N>, Q<km>, Q<J>)", "raw std::fma(N, km, J / 1000)") { return quantity_fma(); }
+//@formatter:on
@@ -0,0 +1,88 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Parsing a large buffer of newline-separated quantities.
+//!
+//! The baseline reads the numbers with `std::from_chars` and skips the unit, so the relative
+//! figures are the cost of resolving the unit symbol and applying its conversion.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+using namespace quantify::temperature;
+
+namespace {
+  constexpr std::size_t lines = 1 << 20;
+
+  //! Builds `lines` lines of the form "<number> <symbol>", cycling through `symbols`
+  std::string make_input(std::initializer_list<std::string_view> symbols) {
+    std::string text{};
+    text.reserve(lines * 16);
+    std::size_t i = 0;
+    for (std::size_t line = 0; line < lines; ++line) {
+      text += std::to_string(static_cast<double>(line % 1000) / 8.0);
+      text += ' ';
+      text += *(symbols.begin() + (i++ % symbols.size()));
+      text += '\n';
+    }
+    return text;
+  }
+
+  const std::string distances = make_input({"m", "km", "mm", "ft", "mi"});
+  const std::string speeds    = make_input({"m/s", "km/hours", "(mi)/(hours)"});
+  const std::string temps     = make_input({"K", "C", "F"});
+
+  bench::result raw_numbers(const std::string& text) {
+    return bench::run([&] {
+             const char* it  = text.data();
+             const char* end = text.data() + text.size();
+             double      sum = 0.0;
+             while (it != end) {
+               double value{};
+               it = std::from_chars(it, end, value).ptr;
+               while (*it != '\n') {
+                 ++it;
+               }
+               ++it;
+               sum += value;
+             }
+             bench::do_not_optimize(sum);
+           })
+      .items(lines)
+      .bytes(static_cast<double>(text.size()));
+  }
+
+  template <typename U>
+  bench::result quantities(const std::string& text) {
+    return bench::run([&] {
+             const char* it  = text.data();
+             const char* end = text.data() + text.size();
+             double      sum = 0.0;
+             while (it != end) {
+               Q<U, double> q{};
+               const auto [ptr, ec] = quantify::from_chars(it, end, q);
+               if (ec != std::errc{}) {
+                 std::abort();
+               }
+               it   = ptr + 1;
+               sum += q.value;
+             }
+             bench::do_not_optimize(sum);
+           })
+      .items(lines)
+      .bytes(static_cast<double>(text.size()));
+  }
+} // namespace
+
+//@formatter:off
+BENCH("raw distances")                                          { return raw_numbers(distances); }
+BENCH_RELATIVE_TO("parse<meter>", "raw distances")              { return quantities<meter>(distances); }
+BENCH("raw speeds")                                             { return raw_numbers(speeds); }
+BENCH_RELATIVE_TO("parse<m/s>", "raw speeds")                   { return quantities<frac<meter, seconds>>(speeds); }
+BENCH("raw temperatures")                                       { return raw_numbers(temps); }
+BENCH_RELATIVE_TO("parse<kelvin>", "raw temperatures")          { return quantities<kelvin>(temps); }
+//@formatter:on
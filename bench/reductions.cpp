@@ -0,0 +1,68 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Reductions over ranges of quantities, against a manual `operator+=` loop, and their scaling
+//! across thread counts. Thread counts above the hardware concurrency oversubscribe the cores.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+
+namespace {
+  constexpr std::size_t samples = 1 << 23;
+
+  const std::vector<Q<millimeter, double>> lengths = [] {
+    std::vector<Q<millimeter, double>> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<double>(i % 1000) / 8.0;
+    }
+    return values;
+  }();
+
+  constexpr double payload_bytes = samples * sizeof(double);
+
+  template <typename Reduce>
+  bench::result reduction(Reduce&& reduce, double bytes = payload_bytes) {
+    return bench::run([&] { bench::do_not_optimize(reduce()); }).items(samples).bytes(bytes);
+  }
+
+  bench::result manual_loop() {
+    return reduction([] {
+      Q<meter, double> total{};
+      for (const auto& q: lengths) {
+        total += q;
+      }
+      return total;
+    });
+  }
+
+  bench::result parallel_sum(unsigned threads) {
+    return reduction([=] { return sum<meter>(parallel_policy{threads}, lengths); });
+  }
+
+  bench::result parallel_dot(unsigned threads) {
+    return reduction(
+      [=] { return dot(parallel_policy{threads}, lengths, lengths).value(); }, 2 * payload_bytes
+    );
+  }
+} // namespace
+
+//@formatter:off
+BENCH("manual += loop into m")                              { return manual_loop(); }
+BENCH_RELATIVE_TO("sum<m>", "manual += loop into m")        { return reduction([] { return sum<meter>(lengths); }); }
+BENCH_RELATIVE_TO("sum<m> (1 thread)", "sum<m>")            { return parallel_sum(1); }
+BENCH_RELATIVE_TO("sum<m> (2 threads)", "sum<m>")           { return parallel_sum(2); }
+BENCH_RELATIVE_TO("sum<m> (4 threads)", "sum<m>")           { return parallel_sum(4); }
+BENCH_RELATIVE_TO("sum<m> (8 threads)", "sum<m>")           { return parallel_sum(8); }
+BENCH("mean")                                               { return reduction([] { return mean(lengths).value(); }); }
+BENCH("min_max")                                            { return reduction([] { return min_max(lengths).value(); }); }
+BENCH_RELATIVE_TO("min_max (par)", "min_max")               { return reduction([] { return min_max(par, lengths).value(); }); }
+BENCH("dot")                                                { return reduction([] { return dot(lengths, lengths).value(); }, 2 * payload_bytes); }
+BENCH_RELATIVE_TO("dot (1 thread)", "dot")                  { return parallel_dot(1); }
+BENCH_RELATIVE_TO("dot (2 threads)", "dot")                 { return parallel_dot(2); }
+BENCH_RELATIVE_TO("dot (4 threads)", "dot")                 { return parallel_dot(4); }
+BENCH_RELATIVE_TO("dot (8 threads)", "dot")                 { return parallel_dot(8); }
+//@formatter:on
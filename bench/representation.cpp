@@ -0,0 +1,86 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Integer representation policies against `double`.
+//!
+//! Every case converts millimeters into meters element-wise and accumulates quantities of the
+//! same unit, the two operations whose cost the representation decides.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+
+namespace {
+  constexpr std::size_t samples = 1 << 16;
+
+  using q16 = binary_fixed<std::int32_t, 16>;
+
+  template <typename T>
+  std::vector<Q<millimeter, T>> inputs() {
+    std::vector<Q<millimeter, T>> result(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      result[i] = Q<millimeter, T>{T{static_cast<std::int32_t>(i % 20000) - 10000}};
+    }
+    return result;
+  }
+
+  //! Converts every sample with `convert`
+  template <typename T, typename Convert>
+  bench::result conversion(Convert&& convert) {
+    const auto                 in = inputs<T>();
+    std::vector<Q<meter, T>>   out(samples);
+    const Q<millimeter, T>* __restrict src = in.data();
+    Q<meter, T>* __restrict dst            = out.data();
+    return bench::run([&] {
+             for (std::size_t i = 0; i < samples; ++i) {
+               dst[i] = convert(src[i]);
+             }
+             bench::do_not_optimize(dst);
+           })
+      .items(samples)
+      .bytes(static_cast<double>(2 * sizeof(T) * samples));
+  }
+
+  template <typename T>
+  bench::result conversion() {
+    return conversion<T>([](const Q<millimeter, T>& q) { return q.template as<meter>(); });
+  }
+
+  //! Sums every sample
+  template <typename T>
+  bench::result accumulation() {
+    const auto in = inputs<T>();
+    return bench::run([&] {
+             Q<millimeter, T> sum{};
+             for (const auto& q: in) {
+               sum += q;
+             }
+             bench::do_not_optimize(sum);
+           })
+      .items(samples)
+      .bytes(static_cast<double>(sizeof(T) * samples));
+  }
+
+  bench::result rounded_conversion() {
+    return conversion<std::int32_t>([](const Q<millimeter, std::int32_t>& q) {
+      return round_as<meter, rounding::to_nearest>(q);
+    });
+  }
+} // namespace
+
+//@formatter:off
+BENCH("double mm -> m")                                              { return conversion<double>(); }
+BENCH_RELATIVE_TO("int32 mm -> m", "double mm -> m")                 { return conversion<std::int32_t>(); }
+BENCH_RELATIVE_TO("int32 mm -> m (to nearest)", "double mm -> m")    { return rounded_conversion(); }
+BENCH_RELATIVE_TO("saturating<int32> mm -> m", "double mm -> m")     { return conversion<saturating<std::int32_t>>(); }
+BENCH_RELATIVE_TO("checked<int32> mm -> m", "double mm -> m")        { return conversion<checked<std::int32_t>>(); }
+BENCH_RELATIVE_TO("binary_fixed<int32, 16> mm -> m", "double mm -> m") { return conversion<q16>(); }
+BENCH("double sum")                                                  { return accumulation<double>(); }
+BENCH_RELATIVE_TO("int32 sum", "double sum")                         { return accumulation<std::int32_t>(); }
+BENCH_RELATIVE_TO("saturating<int32> sum", "double sum")             { return accumulation<saturating<std::int32_t>>(); }
+BENCH_RELATIVE_TO("checked<int32> sum", "double sum")                { return accumulation<checked<std::int32_t>>(); }
+BENCH_RELATIVE_TO("binary_fixed<int32, 16> sum", "double sum")       { return accumulation<q16>(); }
+//@formatter:on
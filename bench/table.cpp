@@ -0,0 +1,130 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Property lookups in a 256-row table of two columns indexed in kelvin, queried in celsius,
+//! against a `std::map` from temperature to both properties with the usual `lower_bound`
+//! followed by a linear interpolation.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::mass;
+using namespace quantify::energy;
+using namespace quantify::distance;
+using namespace quantify::temperature;
+
+namespace {
+  constexpr std::size_t rows    = 256;
+  constexpr std::size_t queries = 1 << 20;
+
+  using specific_heat = frac<joule, mul<kilograms, kelvin>>;
+  using density       = frac<kilograms, mul<meter, meter, meter>>;
+
+  double heat_at(double kelvins) {
+    return 4180.0 + 0.01 * (kelvins - 300.0) * (kelvins - 300.0);
+  }
+
+  double density_at(double kelvins) {
+    return 1000.0 - 0.2 * (kelvins - 277.0);
+  }
+
+  double key_at(std::size_t i) {
+    return 273.15 + static_cast<double>(i) * 0.5;
+  }
+
+  const std::map<double, std::pair<double, double>> naive = [] {
+    std::map<double, std::pair<double, double>> m{};
+    for (std::size_t i = 0; i < rows; ++i) {
+      m.emplace(key_at(i), std::pair{heat_at(key_at(i)), density_at(key_at(i))});
+    }
+    return m;
+  }();
+
+  const table<kelvin, specific_heat, density> properties = [] {
+    table<kelvin, specific_heat, density> t{};
+    for (std::size_t i = 0; i < rows; ++i) {
+      t.insert(
+        Q<kelvin, double>{key_at(i)},
+        Q<specific_heat, double>{heat_at(key_at(i))},
+        Q<density, double>{density_at(key_at(i))}
+      );
+    }
+    return t;
+  }();
+
+  const std::vector<Q<celsius, double>> temperatures = [] {
+    std::vector<Q<celsius, double>> values(queries);
+    std::uint64_t                   state = 0x9E3779B97F4A7C15;
+    for (auto& v: values) {
+      state   = state * 6364136223846793005 + 1442695040888963407;
+      v.value = static_cast<double>(state >> 11) * 0x1.0p-53 * 127.0;
+    }
+    return values;
+  }();
+
+  constexpr double payload_bytes = 3.0 * queries * sizeof(double);
+
+  bench::result map_lookup() {
+    std::vector<double> heats(queries);
+    std::vector<double> densities(queries);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < queries; ++i) {
+               const double k  = temperatures[i].value + 273.15;
+               auto         hi = naive.lower_bound(k);
+               if (hi == naive.begin()) {
+                 ++hi;
+               } else if (hi == naive.end()) {
+                 --hi;
+               }
+               const auto   lo = std::prev(hi);
+               const double t  = (k - lo->first) / (hi->first - lo->first);
+               heats[i]     = lo->second.first + t * (hi->second.first - lo->second.first);
+               densities[i] = lo->second.second + t * (hi->second.second - lo->second.second);
+             }
+             bench::do_not_optimize(heats.data());
+             bench::do_not_optimize(densities.data());
+           })
+      .items(queries)
+      .bytes(payload_bytes);
+  }
+
+  template <interpolation I>
+  bench::result table_lookup() {
+    std::vector<Q<specific_heat, double>> heats(queries);
+    std::vector<Q<density, double>>       densities(queries);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < queries; ++i) {
+               const auto [heat, rho] = properties.lookup<I>(temperatures[i]).value();
+               heats[i]               = heat;
+               densities[i]           = rho;
+             }
+             bench::do_not_optimize(heats.data());
+             bench::do_not_optimize(densities.data());
+           })
+      .items(queries)
+      .bytes(payload_bytes);
+  }
+
+  template <interpolation I>
+  bench::result table_batch() {
+    std::vector<Q<specific_heat, double>> heats(queries);
+    std::vector<Q<density, double>>       densities(queries);
+    return bench::run([&] {
+             const auto written = properties.lookup_into<I>(temperatures, heats, densities);
+             bench::do_not_optimize(written.has_value());
+             bench::do_not_optimize(heats.data());
+             bench::do_not_optimize(densities.data());
+           })
+      .items(queries)
+      .bytes(payload_bytes);
+  }
+} // namespace
+
+//@formatter:off
+BENCH("std::map lower_bound, linear")                                          { return map_lookup(); }
+BENCH_RELATIVE_TO("table lookup, linear", "std::map lower_bound, linear")      { return table_lookup<interpolation::linear>(); }
+BENCH_RELATIVE_TO("table lookup_into, linear", "std::map lower_bound, linear") { return table_batch<interpolation::linear>(); }
+BENCH_RELATIVE_TO("table lookup_into, cubic", "std::map lower_bound, linear")  { return table_batch<interpolation::cubic>(); }
+//@formatter:on
@@ -0,0 +1,148 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Vector quantities against raw `std::array<double, 3>` code, for an explicit Euler step of
+//! many particles, the work done by a force field and a batch conversion of positions.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+using namespace quantify::force;
+
+namespace {
+  constexpr std::size_t particles = 1 << 16;
+
+  using raw3 = std::array<double, 3>;
+  using v3   = vec<double, 3>;
+
+  template <typename V>
+  std::vector<V> inputs(double offset) {
+    std::vector<V> values(particles);
+    for (std::size_t i = 0; i < particles; ++i) {
+      const auto x = static_cast<double>(i % 97) + offset;
+      values[i]    = V{{x, x * 0.5, -x}};
+    }
+    return values;
+  }
+
+  constexpr double payload_bytes = 3.0 * particles * 3 * sizeof(double);
+
+  //! p += v * dt
+  bench::result raw_step() {
+    auto           positions  = inputs<raw3>(1.0);
+    const auto     velocities = inputs<raw3>(2.0);
+    constexpr auto dt         = 0.001;
+    return bench::run([&] {
+             for (std::size_t i = 0; i < particles; ++i) {
+               for (std::size_t k = 0; k < 3; ++k) {
+                 positions[i][k] += velocities[i][k] * dt;
+               }
+             }
+             bench::do_not_optimize(positions.data());
+           })
+      .items(particles)
+      .bytes(payload_bytes);
+  }
+
+  bench::result quantity_step() {
+    std::vector<Q<meter, v3>>                positions(particles);
+    std::vector<Q<frac<meter, seconds>, v3>> velocities(particles);
+    const auto                               raw_positions  = inputs<v3>(1.0);
+    const auto                               raw_velocities = inputs<v3>(2.0);
+    for (std::size_t i = 0; i < particles; ++i) {
+      positions[i]  = raw_positions[i];
+      velocities[i] = raw_velocities[i];
+    }
+    constexpr Q<seconds, double> dt{0.001};
+    return bench::run([&] {
+             for (std::size_t i = 0; i < particles; ++i) {
+               positions[i] += velocities[i] * dt;
+             }
+             bench::do_not_optimize(positions.data());
+           })
+      .items(particles)
+      .bytes(payload_bytes);
+  }
+
+  //! sum(F . d)
+  bench::result raw_work() {
+    const auto forces        = inputs<raw3>(3.0);
+    const auto displacements = inputs<raw3>(4.0);
+    return bench::run([&] {
+             double work = 0.0;
+             for (std::size_t i = 0; i < particles; ++i) {
+               work += forces[i][0] * displacements[i][0] + forces[i][1] * displacements[i][1] +
+                       forces[i][2] * displacements[i][2];
+             }
+             bench::do_not_optimize(work);
+           })
+      .items(particles)
+      .bytes(2.0 * particles * 3 * sizeof(double));
+  }
+
+  bench::result quantity_work() {
+    std::vector<Q<newtons, v3>> forces(particles);
+    std::vector<Q<meter, v3>>   displacements(particles);
+    const auto                  raw_forces        = inputs<v3>(3.0);
+    const auto                  raw_displacements = inputs<v3>(4.0);
+    for (std::size_t i = 0; i < particles; ++i) {
+      forces[i]        = raw_forces[i];
+      displacements[i] = raw_displacements[i];
+    }
+    return bench::run([&] {
+             Q<mul<newtons, meter>, double> work{};
+             for (std::size_t i = 0; i < particles; ++i) {
+               work += dot(forces[i], displacements[i]);
+             }
+             bench::do_not_optimize(work);
+           })
+      .items(particles)
+      .bytes(2.0 * particles * 3 * sizeof(double));
+  }
+
+  //! km -> m
+  bench::result raw_conversion() {
+    const auto        positions = inputs<raw3>(5.0);
+    std::vector<raw3> out(particles);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < particles; ++i) {
+               for (std::size_t k = 0; k < 3; ++k) {
+                 out[i][k] = positions[i][k] * 1000.0;
+               }
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(particles)
+      .bytes(2.0 * particles * 3 * sizeof(double));
+  }
+
+  bench::result quantity_conversion() {
+    std::vector<Q<kilometer, v3>> positions(particles);
+    const auto                    raw_positions = inputs<v3>(5.0);
+    for (std::size_t i = 0; i < particles; ++i) {
+      positions[i] = raw_positions[i];
+    }
+    std::vector<Q<meter, v3>> out(particles);
+    return bench::run([&] {
+             for (std::size_t i = 0; i < particles; ++i) {
+               out[i] = positions[i];
+             }
+             bench::do_not_optimize(out.data());
+           })
+      .items(particles)
+      .bytes(2.0 * particles * 3 * sizeof(double));
+  }
+} // namespace
+
+//@formatter:off
+BENCH("raw array<double, 3> p += v * dt")                                     { return raw_step(); }
+BENCH_RELATIVE_TO("Q<m, vec<double, 3>> p += v * dt", "raw array<double, 3> p += v * dt") { return quantity_step(); }
+BENCH("raw array<double, 3> sum(F . d)")                                      { return raw_work(); }
+BENCH_RELATIVE_TO("Q<N, vec<double, 3>> sum(dot(F, d))", "raw array<double, 3> sum(F . d)") { return quantity_work(); }
+BENCH("raw array<double, 3> km -> m")                                         { return raw_conversion(); }
+BENCH_RELATIVE_TO("Q<km, vec<double, 3>> -> Q<m, ...>", "raw array<double, 3> km -> m") { return quantity_conversion(); }
+//@formatter:on
@@ -0,0 +1,106 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+
+//! Throughput of the binary wire format, against writing the same quantities as text.
+
+#include "bench_structure.h"
+
+import quantify;
+
+using namespace quantify;
+using namespace quantify::distance;
+
+namespace {
+  constexpr std::size_t samples = 1 << 20;
+
+  //! Sink appending to a pre-allocated buffer, so that only the encoding is measured
+  struct memory_sink {
+    std::vector<char> bytes{};
+
+    void write(const char* data, std::streamsize size) {
+      bytes.insert(bytes.end(), data, data + size);
+    }
+  };
+
+  const std::vector<Q<meter, double>> distances = [] {
+    std::vector<Q<meter, double>> values(samples);
+    for (std::size_t i = 0; i < samples; ++i) {
+      values[i] = static_cast<double>(i % 1000) / 8.0;
+    }
+    return values;
+  }();
+
+  constexpr double payload_bytes = samples * sizeof(double);
+
+  const std::vector<std::uint64_t> encoded = [] {
+    memory_sink sink{};
+    wire_writer writer{sink};
+    writer.block_size = 1 << 16;
+    writer.write(std::span{distances});
+    std::vector<std::uint64_t> aligned((sink.bytes.size() + 7) / 8);
+    std::memcpy(aligned.data(), sink.bytes.data(), sink.bytes.size());
+    return aligned;
+  }();
+} // namespace
+
+BENCH("wire write") {
+  memory_sink sink{};
+  sink.bytes.reserve(samples * sizeof(double) * 2);
+  return bench::run([&] {
+           sink.bytes.clear();
+           wire_writer writer{sink};
+           writer.block_size = 1 << 16;
+           writer.write(std::span{distances});
+           bench::do_not_optimize(sink.bytes.data());
+         })
+    .items(samples)
+    .bytes(payload_bytes);
+}
+
+BENCH("wire read (view)") {
+  return bench::run([&] {
+           auto   reader = wire_reader::open(std::as_bytes(std::span{encoded})).value();
+           double sum    = 0.0;
+           while (!reader.done()) {
+             const auto values = reader.next().value().as<meter, double>().value();
+             for (const auto& q: values) {
+               sum += q.value;
+             }
+           }
+           bench::do_not_optimize(sum);
+         })
+    .items(samples)
+    .bytes(payload_bytes);
+}
+
+BENCH("wire read (stream)") {
+  const std::string bytes{reinterpret_cast<const char*>(encoded.data()), encoded.size() * 8};
+  return bench::run([&] {
+           std::istringstream in{bytes};
+           auto               reader = wire_stream_reader::open(in).value();
+           double             sum    = 0.0;
+           while (!reader.done()) {
+             const auto values = reader.next().value().as<meter, double>().value();
+             for (const auto& q: values) {
+               sum += q.value;
+             }
+           }
+           bench::do_not_optimize(sum);
+         })
+    .items(samples)
+    .bytes(payload_bytes);
+}
+
+BENCH_RELATIVE_TO("to_string", "wire write") {
+  std::string text{};
+  return bench::run([&] {
+           text.clear();
+           for (const auto& q: distances) {
+             text += q.to_string();
+             text += '\n';
+           }
+           bench::do_not_optimize(text.data());
+         })
+    .items(samples)
+    .bytes(payload_bytes);
+}
@@ -0,0 +1,118 @@
+# Copyright (c) 2024-2025, Víctor Castillo Agüero.
+# SPDX-License-Identifier: Apache-2.0
+
+macro(target_configure_bench_directory BENCH_TARGET BENCH_DIR)
+    add_custom_target(BENCH_SUITE_${BENCH_TARGET})
+    add_custom_target(BENCH_RUN_${BENCH_TARGET})
+
+    get_filename_component(BENCH_DIR ${BENCH_DIR} REALPATH)
+
+    FILE(GLOB BENCH_LIST
+            ${BENCH_DIR}/*.cpp
+    )
+    foreach (bench ${BENCH_LIST})
+        get_filename_component(BName ${bench} NAME_WLE)
+        add_executable(BENCH_${BName} ${bench})
+        target_link_libraries(BENCH_${BName} PRIVATE ${BENCH_TARGET})
+        target_include_directories(BENCH_${BName} PRIVATE ${BENCH_DIR}/common)
+        target_compile_options(BENCH_${BName} PRIVATE -O2)
+
+        add_dependencies(BENCH_SUITE_${BENCH_TARGET} BENCH_${BName})
+        add_custom_command(TARGET BENCH_RUN_${BENCH_TARGET} POST_BUILD
+                COMMAND $<TARGET_FILE:BENCH_${BName}>
+                COMMENT "Running benchmark ${BName}"
+                VERBATIM
+        )
+    endforeach ()
+    add_dependencies(BENCH_RUN_${BENCH_TARGET} BENCH_SUITE_${BENCH_TARGET})
+endmacro()
+
+# Compiles BENCH_FILE once per size in `SIZES`, defining QUANTIFY_BENCH_TERMS to that size.
+# Each compilation is timed, and an artificially low template depth makes sure instantiation
+# depth does not grow with the amount of terms. Clang additionally emits a -ftime-trace report
+# next to each object file.
+macro(target_configure_compile_bench BENCH_TARGET BENCH_FILE)
+    get_filename_component(CBName ${BENCH_FILE} NAME_WLE)
+    add_custom_target(BENCH_COMPILE_${CBName})
+
+    foreach (size ${ARGN})
+        add_executable(BENCH_COMPILE_${CBName}_${size} EXCLUDE_FROM_ALL ${BENCH_FILE})
+        target_link_libraries(BENCH_COMPILE_${CBName}_${size} PRIVATE ${BENCH_TARGET})
+        target_compile_definitions(BENCH_COMPILE_${CBName}_${size} PRIVATE QUANTIFY_BENCH_TERMS=${size})
+        target_compile_options(BENCH_COMPILE_${CBName}_${size} PRIVATE -ftemplate-depth=128)
+        if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            target_compile_options(BENCH_COMPILE_${CBName}_${size} PRIVATE -ftime-trace)
+        endif ()
+        set_target_properties(BENCH_COMPILE_${CBName}_${size} PROPERTIES
+                CXX_COMPILER_LAUNCHER "${CMAKE_COMMAND};-E;time"
+        )
+        add_dependencies(BENCH_COMPILE_${CBName} BENCH_COMPILE_${CBName}_${size})
+    endforeach ()
+endmacro()
+
+# Compiles BENCH_FILE, made of `raw_<case>`/`quantity_<case>` function pairs, and adds a
+# BENCH_CODEGEN_<name> target that compares their disassembly with codegen_check.cmake.
+# Set QUANTIFY_CODEGEN_STRICT to make any difference fail the target.
+macro(target_configure_codegen_check BENCH_TARGET BENCH_FILE)
+    get_filename_component(CGName ${BENCH_FILE} NAME_WLE)
+    add_library(BENCH_CODEGEN_${CGName}_objects OBJECT EXCLUDE_FROM_ALL ${BENCH_FILE})
+    target_link_libraries(BENCH_CODEGEN_${CGName}_objects PRIVATE ${BENCH_TARGET})
+    target_compile_options(BENCH_CODEGEN_${CGName}_objects PRIVATE -O2 -ffunction-sections)
+
+    if (NOT CMAKE_OBJDUMP)
+        find_program(CMAKE_OBJDUMP objdump)
+    endif ()
+    add_custom_target(BENCH_CODEGEN_${CGName}
+            COMMAND ${CMAKE_COMMAND}
+                -DOBJDUMP=${CMAKE_OBJDUMP}
+                "-DOBJECTS=$<TARGET_OBJECTS:BENCH_CODEGEN_${CGName}_objects>"
+                -DSTRICT=${QUANTIFY_CODEGEN_STRICT}
+                -P ${QUANTIFY_CMAKE_DIR}/codegen_check.cmake
+            DEPENDS BENCH_CODEGEN_${CGName}_objects
+            COMMENT "Comparing raw and quantity code generation in ${CGName}"
+            VERBATIM
+    )
+endmacro()
+
+# Compiles one translation unit per module in `ARGN` that does nothing but import it, from the
+# BENCH_TEMPLATE file. Entries written as `<module>:<scale>` get a second translation unit that
+# also converts and multiplies quantities between every pair of units of `quantify::<scale>`.
+# Compilations are timed like in target_configure_compile_bench: the first one is the cost of
+# importing the module, and the difference with the second one the cost of instantiating it.
+macro(target_configure_import_bench BENCH_TARGET BENCH_TEMPLATE)
+    get_filename_component(IBName ${BENCH_TEMPLATE} NAME_WE)
+    add_custom_target(BENCH_COMPILE_${IBName})
+
+    foreach (entry ${ARGN})
+        string(REPLACE ":" ";" IBEntry ${entry})
+        list(GET IBEntry 0 QUANTIFY_BENCH_MODULE)
+        list(LENGTH IBEntry IBEntryLength)
+        set(IBVariants import)
+        if (IBEntryLength GREATER 1)
+            list(GET IBEntry 1 QUANTIFY_BENCH_SCALE)
+            list(APPEND IBVariants instantiate)
+        endif ()
+        string(REPLACE "." "_" IBModule ${QUANTIFY_BENCH_MODULE})
+
+        foreach (variant ${IBVariants})
+            set(QUANTIFY_BENCH_INSTANTIATE 0)
+            if (variant STREQUAL "instantiate")
+                set(QUANTIFY_BENCH_INSTANTIATE 1)
+            endif ()
+            set(IBTarget BENCH_COMPILE_${IBName}_${IBModule}_${variant})
+            set(IBSource ${CMAKE_CURRENT_BINARY_DIR}/${IBName}/${IBModule}_${variant}.cpp)
+            configure_file(${BENCH_TEMPLATE} ${IBSource} @ONLY)
+
+            add_executable(${IBTarget} EXCLUDE_FROM_ALL ${IBSource})
+            target_link_libraries(${IBTarget} PRIVATE ${BENCH_TARGET})
+            if (CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+                target_compile_options(${IBTarget} PRIVATE -ftime-trace)
+            endif ()
+            set_target_properties(${IBTarget} PROPERTIES
+                    CXX_COMPILER_LAUNCHER "${CMAKE_COMMAND};-E;time"
+            )
+            add_dependencies(BENCH_COMPILE_${IBName} ${IBTarget})
+        endforeach ()
+        unset(QUANTIFY_BENCH_SCALE)
+    endforeach ()
+endmacro()
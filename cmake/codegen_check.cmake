@@ -0,0 +1,85 @@
+# Copyright (c) 2024-2025, Víctor Castillo Agüero.
+# SPDX-License-Identifier: Apache-2.0
+
+# Compares the disassembly of `raw_<case>` and `quantity_<case>` function pairs.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECTS=<obj;...> [-DSTRICT=ON] -P codegen_check.cmake
+#
+# Each pair is reported as:
+#   - SAME      identical instructions
+#   - OPERANDS  same instruction sequence, different operands (e.g. swapped commutative operands)
+#   - DIFF      different instructions
+# With STRICT=ON any pair that is not SAME fails the check.
+
+if (NOT OBJDUMP OR NOT OBJECTS)
+    message(FATAL_ERROR "codegen_check: OBJDUMP and OBJECTS must be set")
+endif ()
+
+set(FUNCTIONS "")
+foreach (object ${OBJECTS})
+    execute_process(
+            COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+            OUTPUT_VARIABLE DISASSEMBLY
+            RESULT_VARIABLE OBJDUMP_RESULT
+    )
+    if (NOT OBJDUMP_RESULT EQUAL 0)
+        message(FATAL_ERROR "codegen_check: could not disassemble ${object}")
+    endif ()
+
+    string(REPLACE ";" "\;" DISASSEMBLY "${DISASSEMBLY}")
+    string(REPLACE "\n" ";" LINES "${DISASSEMBLY}")
+    set(CURRENT "")
+    foreach (line IN LISTS LINES)
+        if (line MATCHES "^[0-9a-f]+ <([A-Za-z0-9_]+)>:$")
+            set(CURRENT ${CMAKE_MATCH_1})
+            list(APPEND FUNCTIONS ${CURRENT})
+            set(CODE_${CURRENT} "")
+            set(OPS_${CURRENT} "")
+        elseif (CURRENT AND line MATCHES "^ *[0-9a-f]+:\t(.*)$")
+            # Drop addresses and the symbolic comments objdump appends to relative operands
+            string(REGEX REPLACE " *#.*$" "" instruction "${CMAKE_MATCH_1}")
+            string(REGEX REPLACE " +<[^>]*>" "" instruction "${instruction}")
+            string(REGEX REPLACE "[ \t]+" " " instruction "${instruction}")
+            string(REGEX MATCH "^[^ ]+" mnemonic "${instruction}")
+            # Alignment padding depends on the layout of the object, not on the function
+            if (mnemonic MATCHES "^(nop[wl]?|data16|cs|int3)$")
+                continue()
+            endif ()
+            string(APPEND CODE_${CURRENT} "    ${instruction}\n")
+            string(APPEND OPS_${CURRENT} "${mnemonic} ")
+        elseif (line STREQUAL "")
+            set(CURRENT "")
+        endif ()
+    endforeach ()
+endforeach ()
+
+set(PAIRS 0)
+set(FLAGGED 0)
+foreach (function ${FUNCTIONS})
+    if (NOT function MATCHES "^raw_(.+)$")
+        continue()
+    endif ()
+    set(case ${CMAKE_MATCH_1})
+    if (NOT DEFINED CODE_quantity_${case})
+        message(WARNING "codegen_check: raw_${case} has no quantity_${case} counterpart")
+        continue()
+    endif ()
+
+    math(EXPR PAIRS "${PAIRS} + 1")
+    if (CODE_raw_${case} STREQUAL CODE_quantity_${case})
+        message(STATUS "SAME      ${case}")
+    else ()
+        math(EXPR FLAGGED "${FLAGGED} + 1")
+        if (OPS_raw_${case} STREQUAL OPS_quantity_${case})
+            message(STATUS "OPERANDS  ${case}")
+        else ()
+            message(STATUS "DIFF      ${case}")
+        endif ()
+        message(STATUS "  raw:\n${CODE_raw_${case}}  quantity:\n${CODE_quantity_${case}}")
+    endif ()
+endforeach ()
+
+message(STATUS "codegen_check: ${FLAGGED} of ${PAIRS} pairs differ")
+if (STRICT AND FLAGGED GREATER 0)
+    message(FATAL_ERROR "codegen_check: quantity code differs from raw code")
+endif ()
@@ -0,0 +1,37 @@
+# Copyright (c) 2024-2025, Víctor Castillo Agüero.
+# SPDX-License-Identifier: Apache-2.0
+
+# Installs TARGET with its headers, module interface units and compiled BMIs, and exports it as
+# `<TARGET>::<TARGET>` for `find_package(<TARGET>)`. Consumers build their own BMIs of the
+# installed interface units, with their own flags, only for the modules they import.
+macro(target_configure_install TARGET)
+    include(GNUInstallDirs)
+    include(CMakePackageConfigHelpers)
+
+    get_target_property(PACKTL_IMPORTED packtl IMPORTED)
+    if (NOT PACKTL_IMPORTED)
+        message(FATAL_ERROR "QUANTIFY_INSTALL needs packtl to be installed and found by find_package(packtl).")
+    endif ()
+
+    install(TARGETS ${TARGET}
+            EXPORT ${TARGET}-targets
+            ARCHIVE DESTINATION ${CMAKE_INSTALL_LIBDIR}
+            LIBRARY DESTINATION ${CMAKE_INSTALL_LIBDIR}
+            FILE_SET HEADERS DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}
+            FILE_SET cxx_modules DESTINATION ${CMAKE_INSTALL_INCLUDEDIR}
+            CXX_MODULES_BMI DESTINATION ${CMAKE_INSTALL_LIBDIR}/${TARGET}/bmi
+    )
+    install(EXPORT ${TARGET}-targets
+            NAMESPACE ${TARGET}::
+            DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/${TARGET}
+            CXX_MODULES_DIRECTORY cxx-modules
+    )
+
+    configure_package_config_file(${QUANTIFY_CMAKE_DIR}/${TARGET}-config.cmake.in
+            ${CMAKE_CURRENT_BINARY_DIR}/${TARGET}-config.cmake
+            INSTALL_DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/${TARGET}
+    )
+    install(FILES ${CMAKE_CURRENT_BINARY_DIR}/${TARGET}-config.cmake
+            DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/${TARGET}
+    )
+endmacro()
@@ -0,0 +1,207 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  convert.cppm
+ *  \brief Batch unit conversion over contiguous buffers of quantities
+ *
+ */
+
+module;
+#include <version>
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+export module quantify.algorithms:convert;
+import std;
+import quantify.core;
+import quantify.conversion;
+
+namespace quantify {
+  //! @cond NEVER
+  namespace detail {
+    template <typename U, typename T>
+    concept LayoutCompatible = sizeof(quantity<U, T>) == sizeof(T) &&
+                               alignof(quantity<U, T>) == alignof(T) &&
+                               std::is_standard_layout_v<quantity<U, T>> &&
+                               std::is_trivially_copyable_v<quantity<U, T>>;
+
+    /*! Ends the lifetime of the quantities in `buffer` and starts that of as many quantities of
+     *  unit `U_TO` in their storage, holding the same values.
+     */
+    template <typename U_TO, typename U_FROM, typename T>
+    quantity<U_TO, T>* reuse_storage(std::span<quantity<U_FROM, T>> buffer) noexcept {
+      if (buffer.empty()) {
+        return nullptr;
+      }
+#if defined(__cpp_lib_start_lifetime_as)
+      return std::start_lifetime_as_array<quantity<U_TO, T>>(buffer.data(), buffer.size());
+#else
+      // memmove implicitly creates the objects of its destination and returns a pointer to
+      // them; copying the storage onto itself is folded away by the compiler
+      void* storage = buffer.data();
+      return static_cast<quantity<U_TO, T>*>(std::memmove(storage, storage, buffer.size_bytes()));
+#endif
+    }
+
+    /*! Computes `out[i] = in[i] * scale (+ offset)` over `n` values. `in` and `out` may alias
+     *  as long as they are equal.
+     */
+    template <bool Affine, typename T>
+    void affine_kernel(const T* in, T* out, std::size_t n, T scale, T offset) noexcept {
+      std::size_t i = 0;
+#if defined(__AVX512F__)
+      if constexpr (std::is_same_v<T, double>) {
+        const __m512d a = _mm512_set1_pd(scale);
+        const __m512d b = _mm512_set1_pd(offset);
+        for (; i + 8 <= n; i += 8) {
+          __m512d x = _mm512_loadu_pd(in + i);
+          x         = Affine ? _mm512_fmadd_pd(x, a, b) : _mm512_mul_pd(x, a);
+          _mm512_storeu_pd(out + i, x);
+        }
+      } else if constexpr (std::is_same_v<T, float>) {
+        const __m512 a = _mm512_set1_ps(scale);
+        const __m512 b = _mm512_set1_ps(offset);
+        for (; i + 16 <= n; i += 16) {
+          __m512 x = _mm512_loadu_ps(in + i);
+          x        = Affine ? _mm512_fmadd_ps(x, a, b) : _mm512_mul_ps(x, a);
+          _mm512_storeu_ps(out + i, x);
+        }
+      }
+#elif defined(__AVX2__)
+      if constexpr (std::is_same_v<T, double>) {
+        const __m256d a = _mm256_set1_pd(scale);
+        const __m256d b = _mm256_set1_pd(offset);
+        for (; i + 4 <= n; i += 4) {
+          __m256d x = _mm256_loadu_pd(in + i);
+#if defined(__FMA__)
+          x = Affine ? _mm256_fmadd_pd(x, a, b) : _mm256_mul_pd(x, a);
+#else
+          x = Affine ? _mm256_add_pd(_mm256_mul_pd(x, a), b) : _mm256_mul_pd(x, a);
+#endif
+          _mm256_storeu_pd(out + i, x);
+        }
+      } else if constexpr (std::is_same_v<T, float>) {
+        const __m256 a = _mm256_set1_ps(scale);
+        const __m256 b = _mm256_set1_ps(offset);
+        for (; i + 8 <= n; i += 8) {
+          __m256 x = _mm256_loadu_ps(in + i);
+#if defined(__FMA__)
+          x = Affine ? _mm256_fmadd_ps(x, a, b) : _mm256_mul_ps(x, a);
+#else
+          x = Affine ? _mm256_add_ps(_mm256_mul_ps(x, a), b) : _mm256_mul_ps(x, a);
+#endif
+          _mm256_storeu_ps(out + i, x);
+        }
+      }
+#endif
+      // Scalar fallback, also handles the tail of the vectorized loops.
+      for (; i < n; ++i) {
+        if constexpr (Affine) {
+          out[i] = in[i] * scale + offset;
+        } else {
+          out[i] = in[i] * scale;
+        }
+      }
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Converts a contiguous buffer of quantities into another unit
+   *
+   * The conversion is folded into a single precomputed coefficient (plus an offset for affine
+   * scale conversions such as `celsius -> kelvin`) which is applied by a vectorized kernel when
+   * the target supports AVX2 or AVX-512, and by a scalar loop otherwise, see
+   * @ref quantify::linear_conversion. Data types other than `float` and `double`, and
+   * conversions that are not linear, are converted element-wise through
+   * @ref quantify::quantity::as().
+   *
+   * `in` and `out` must either be disjoint or refer to the same memory.
+   *
+   * @tparam U_TO Target unit
+   * @param in Quantities to convert
+   * @param out Converted quantities
+   * @return Nothing, or `std::errc::invalid_argument` if `in` and `out` have different sizes, in
+   *         which case nothing is converted.
+   */
+  export template <typename U_TO, typename U_FROM, typename T>
+    requires ConvertibleTo<U_FROM, U_TO, T>
+  [[nodiscard]]
+  std::expected<void, std::errc>
+  convert(std::span<const quantity<U_FROM, T>> in, std::span<quantity<U_TO, T>> out) noexcept {
+    if (in.size() != out.size()) [[unlikely]] {
+      return std::unexpected{std::errc::invalid_argument};
+    }
+    const std::size_t n = in.size();
+
+    if constexpr (std::is_floating_point_v<T> && LinearlyConvertibleTo<U_FROM, U_TO> &&
+                  detail::LayoutCompatible<U_FROM, T> && detail::LayoutCompatible<U_TO, T>) {
+      using conversion = linear_conversion<U_FROM, U_TO, T>;
+      detail::affine_kernel<conversion::is_affine>(
+        reinterpret_cast<const T*>(in.data()),
+        reinterpret_cast<T*>(out.data()),
+        n,
+        conversion::scale,
+        conversion::offset
+      );
+    } else {
+      for (std::size_t i = 0; i < n; ++i) {
+        out[i] = in[i].template as<U_TO>();
+      }
+    }
+    return {};
+  }
+
+  //! See @ref quantify::convert
+  export template <typename U_TO, typename U_FROM, typename T>
+    requires ConvertibleTo<U_FROM, U_TO, T>
+  [[nodiscard]]
+  std::expected<void, std::errc>
+  convert(std::span<quantity<U_FROM, T>> in, std::span<quantity<U_TO, T>> out) noexcept {
+    return convert<U_TO>(std::span<const quantity<U_FROM, T>>{in}, out);
+  }
+
+  /*! @brief Converts a contiguous buffer of quantities into another unit, in place
+   *
+   * The storage of `buffer` is reused for the converted quantities, which are returned as a
+   * view over the same memory. `buffer` must not be accessed through its original unit
+   * afterwards.
+   *
+   * @tparam U_TO Target unit
+   * @param buffer Quantities to convert
+   * @return View of the converted quantities
+   */
+  export template <typename U_TO, typename U_FROM, typename T>
+    requires ConvertibleTo<U_FROM, U_TO, T> && detail::LayoutCompatible<U_FROM, T> &&
+             detail::LayoutCompatible<U_TO, T>
+  [[nodiscard]]
+  std::span<quantity<U_TO, T>> convert_in_place(std::span<quantity<U_FROM, T>> buffer) noexcept {
+    if constexpr (std::is_floating_point_v<T> && LinearlyConvertibleTo<U_FROM, U_TO>) {
+      using conversion = linear_conversion<U_FROM, U_TO, T>;
+      detail::affine_kernel<conversion::is_affine>(
+        reinterpret_cast<const T*>(buffer.data()),
+        reinterpret_cast<T*>(buffer.data()),
+        buffer.size(),
+        conversion::scale,
+        conversion::offset
+      );
+    } else {
+      for (auto& q: buffer) {
+        q.value = q.template as<U_TO>().value;
+      }
+    }
+    return {detail::reuse_storage<U_TO>(buffer), buffer.size()};
+  }
+} // namespace quantify
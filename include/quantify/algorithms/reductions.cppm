@@ -0,0 +1,411 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  reductions.cppm
+ *  \brief Unit-aware reductions over ranges of quantities
+ *
+ * Every reduction works on the raw values of the range and applies the unit of the result, or
+ * any conversion into another unit, once at the end instead of once per element. Floating point
+ * values are accumulated with pairwise summation, whose rounding error grows with `log(n)`
+ * rather than with `n`, and whose leaf blocks keep several independent partial sums so that
+ * they vectorize without reassociating the additions. Integral and custom data types are
+ * accumulated in order.
+ *
+ * Every reduction has an overload taking an execution policy first, which splits the range
+ * into one contiguous chunk per thread and combines the partial results in order.
+ */
+
+module;
+#include <version>
+
+export module quantify.algorithms:reductions;
+import std;
+import quantify.core;
+import quantify.conversion;
+
+export namespace quantify {
+  /*! @brief Random access range of quantities whose size is known
+   */
+  template <typename R>
+  concept QuantityRange = std::ranges::random_access_range<R> && std::ranges::sized_range<R> &&
+                          QuantityConcept<std::ranges::range_value_t<R>>;
+
+  //! Quantity type of the elements of `R`
+  template <QuantityRange R>
+  using range_quantity_t = std::ranges::range_value_t<R>;
+
+  /*! @brief Execution policy that runs reductions on `threads` threads
+   *
+   * A value of 0 uses as many threads as the hardware supports. Ranges too short to be worth
+   * splitting are reduced on fewer threads, down to the calling thread alone.
+   */
+  struct parallel_policy {
+    unsigned threads = 0;
+  };
+
+  //! Runs reductions on as many threads as the hardware supports
+  inline constexpr parallel_policy par{};
+
+  /*! @brief Execution policy accepted by the reductions
+   *
+   * Either a @ref quantify::parallel_policy or, when the standard library provides them, one of
+   * the standard execution policies: `std::execution::par` and `par_unseq` run on as many
+   * threads as the hardware supports, and `seq` and `unseq` on the calling thread.
+   */
+  template <typename P>
+  concept ExecutionPolicy = std::same_as<std::remove_cvref_t<P>, parallel_policy>
+#if defined(__cpp_lib_execution)
+                            || std::is_execution_policy_v<std::remove_cvref_t<P>>
+#endif
+    ;
+
+  //! @cond NEVER
+  namespace detail {
+    //! Length of the blocks that pairwise summation adds directly
+    constexpr std::size_t pairwise_block = 128;
+
+    //! Fewest elements worth handing to a thread of their own
+    constexpr std::size_t parallel_grain = std::size_t{1} << 15;
+
+    //! Sum of `term(i)` for every `i` in `[first, last)`
+    template <typename T, typename Term>
+    constexpr T pairwise_sum(std::size_t first, std::size_t last, const Term& term) {
+      if constexpr (!std::is_floating_point_v<T>) {
+        T total{};
+        for (std::size_t i = first; i < last; ++i) {
+          total += term(i);
+        }
+        return total;
+      } else if (last - first > pairwise_block) {
+        const std::size_t middle = first + (last - first) / 2;
+        return pairwise_sum<T>(first, middle, term) + pairwise_sum<T>(middle, last, term);
+      } else {
+        T           partial[8]{};
+        std::size_t i = first;
+        for (; i + 8 <= last; i += 8) {
+          for (std::size_t j = 0; j < 8; ++j) {
+            partial[j] += term(i + j);
+          }
+        }
+        T tail{};
+        for (; i < last; ++i) {
+          tail += term(i);
+        }
+        return ((partial[0] + partial[1]) + (partial[2] + partial[3])) +
+               ((partial[4] + partial[5]) + (partial[6] + partial[7])) + tail;
+      }
+    }
+
+    //! Number of threads `policy` reduces `n` elements on
+    template <typename P>
+    unsigned thread_count(const P& policy, std::size_t n) noexcept {
+      unsigned threads = 1;
+      if constexpr (std::same_as<P, parallel_policy>) {
+        threads = policy.threads;
+      }
+#if defined(__cpp_lib_execution)
+      else if constexpr (std::same_as<P, std::execution::parallel_policy> ||
+                         std::same_as<P, std::execution::parallel_unsequenced_policy>) {
+        threads = 0;
+      }
+#endif
+      if (threads == 0) {
+        threads = std::max(1U, std::thread::hardware_concurrency());
+      }
+      return static_cast<unsigned>(std::clamp<std::size_t>(n / parallel_grain, 1, threads));
+    }
+
+    /*! Splits `[0, n)` into one contiguous chunk per thread and reduces each of them with
+     *  `reduce(first, last)`, returning the partial results in order. The calling thread
+     *  reduces the first chunk.
+     */
+    template <typename Result, typename Reduce>
+    std::vector<Result> reduce_chunks(unsigned threads, std::size_t n, const Reduce& reduce) {
+      std::vector<Result> partials(threads);
+      const std::size_t   chunk = n / threads;
+      {
+        std::vector<std::jthread> workers{};
+        workers.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; ++t) {
+          workers.emplace_back([&, t] {
+            partials[t] = reduce(t * chunk, t + 1 == threads ? n : (t + 1) * chunk);
+          });
+        }
+        partials[0] = reduce(0, chunk);
+      }
+      return partials;
+    }
+
+    //! Sum of `term(i)` for every `i` in `[0, n)`, on `threads` threads
+    template <typename T, typename Term>
+    constexpr T sum_terms(unsigned threads, std::size_t n, const Term& term) {
+      if (threads <= 1) {
+        return pairwise_sum<T>(0, n, term);
+      }
+      const auto partials = reduce_chunks<T>(threads, n, [&](std::size_t first, std::size_t last) {
+        return pairwise_sum<T>(first, last, term);
+      });
+      return pairwise_sum<T>(0, partials.size(), [&](std::size_t i) { return partials[i]; });
+    }
+
+    //! Accessor of the `i`-th raw value of `range`
+    template <QuantityRange R>
+    constexpr auto values_of(R& range) noexcept {
+      return [first = std::ranges::begin(range)](std::size_t i) {
+        return first[static_cast<std::ranges::range_difference_t<R>>(i)].value;
+      };
+    }
+
+    template <QuantityRange R>
+    constexpr range_quantity_t<R> sum(unsigned threads, R& range) {
+      using T = typename range_quantity_t<R>::data_type;
+      return {sum_terms<T>(threads, std::ranges::size(range), values_of(range))};
+    }
+
+    template <QuantityRange R>
+    constexpr std::expected<range_quantity_t<R>, std::errc> mean(unsigned threads, R& range) {
+      using T             = typename range_quantity_t<R>::data_type;
+      const std::size_t n = std::ranges::size(range);
+      if (n == 0) {
+        return std::unexpected(std::errc::invalid_argument);
+      }
+      return range_quantity_t<R>{sum(threads, range).value / static_cast<T>(n)};
+    }
+
+    template <QuantityRange R>
+    constexpr std::expected<std::ranges::min_max_result<range_quantity_t<R>>, std::errc>
+    min_max(unsigned threads, R& range) {
+      using T             = typename range_quantity_t<R>::data_type;
+      using extremes      = std::ranges::min_max_result<T>;
+      const std::size_t n = std::ranges::size(range);
+      if (n == 0) {
+        return std::unexpected(std::errc::invalid_argument);
+      }
+
+      const auto value  = values_of(range);
+      const auto reduce = [&](std::size_t first, std::size_t last) {
+        extremes result{value(first), value(first)};
+        for (std::size_t i = first + 1; i < last; ++i) {
+          const T v  = value(i);
+          result.min = v < result.min ? v : result.min;
+          result.max = result.max < v ? v : result.max;
+        }
+        return result;
+      };
+
+      extremes result{};
+      if (threads <= 1) {
+        result = reduce(0, n);
+      } else {
+        const auto partials = reduce_chunks<extremes>(threads, n, reduce);
+        result              = partials[0];
+        for (const auto& partial: partials) {
+          result.min = partial.min < result.min ? partial.min : result.min;
+          result.max = result.max < partial.max ? partial.max : result.max;
+        }
+      }
+      return std::ranges::min_max_result<range_quantity_t<R>>{{result.min}, {result.max}};
+    }
+
+    template <QuantityRange RA, QuantityRange RB>
+    using dot_result_t = decltype(
+      std::declval<const range_quantity_t<RA>&>() * std::declval<const range_quantity_t<RB>&>()
+    );
+
+    template <QuantityRange RA, QuantityRange RB>
+    constexpr std::expected<dot_result_t<RA, RB>, std::errc>
+    dot(unsigned threads, RA& lhs, RB& rhs) {
+      using QA     = range_quantity_t<RA>;
+      using QB     = range_quantity_t<RB>;
+      using T      = typename QA::data_type;
+      using result = dot_result_t<RA, RB>;
+
+      const std::size_t n = std::ranges::size(lhs);
+      if (n != std::ranges::size(rhs)) {
+        return std::unexpected(std::errc::invalid_argument);
+      }
+      const auto a     = values_of(lhs);
+      const auto b     = values_of(rhs);
+      const T    total = sum_terms<T>(threads, n, [&](std::size_t i) { return a(i) * b(i); });
+      if constexpr (SameScale<typename QA::unit, typename QB::unit>) {
+        using UA = reduce<typename QA::unit>;
+        return result{apply_factor<conversion_factor_v<typename QB::unit, UA>>(total)};
+      } else {
+        return result{total};
+      }
+    }
+
+    template <QuantityRange R, typename W>
+    constexpr std::expected<range_quantity_t<R>, std::errc>
+    weighted_sum(unsigned threads, R& range, W& weights) {
+      using T = typename range_quantity_t<R>::data_type;
+
+      const std::size_t n = std::ranges::size(range);
+      if (n != std::ranges::size(weights)) {
+        return std::unexpected(std::errc::invalid_argument);
+      }
+      const auto value  = values_of(range);
+      const auto weight = [first = std::ranges::begin(weights)](std::size_t i) {
+        return static_cast<T>(first[static_cast<std::ranges::range_difference_t<W>>(i)]);
+      };
+      return range_quantity_t<R>{
+        sum_terms<T>(threads, n, [&](std::size_t i) { return value(i) * weight(i); })
+      };
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Random access range of scalar weights for quantities of data type `T`
+   */
+  template <typename W, typename T>
+  concept WeightRange = std::ranges::random_access_range<W> && std::ranges::sized_range<W> &&
+                        std::convertible_to<std::ranges::range_value_t<W>, T>;
+
+  /*! @brief Sum of the quantities in `range`, in their unit
+   *
+   * @param range Quantities to add
+   */
+  template <QuantityRange R>
+  [[nodiscard]]
+  constexpr range_quantity_t<R> sum(R&& range) {
+    return detail::sum(1, range);
+  }
+
+  //! See @ref quantify::sum, reduced according to `policy`
+  template <ExecutionPolicy P, QuantityRange R>
+  [[nodiscard]]
+  range_quantity_t<R> sum(P&& policy, R&& range) {
+    return detail::sum(detail::thread_count(policy, std::ranges::size(range)), range);
+  }
+
+  /*! @brief Sum of the quantities in `range`, converted once into unit `U_TO`
+   *
+   * @tparam U_TO Unit of the result
+   * @param range Quantities to add
+   */
+  template <typename U_TO, QuantityRange R>
+    requires ConvertibleTo<
+      typename range_quantity_t<R>::unit,
+      U_TO,
+      typename range_quantity_t<R>::data_type>
+  [[nodiscard]]
+  constexpr auto sum(R&& range) {
+    return detail::sum(1, range).template as<U_TO>();
+  }
+
+  //! See @ref quantify::sum, reduced according to `policy`
+  template <typename U_TO, ExecutionPolicy P, QuantityRange R>
+    requires ConvertibleTo<
+      typename range_quantity_t<R>::unit,
+      U_TO,
+      typename range_quantity_t<R>::data_type>
+  [[nodiscard]]
+  auto sum(P&& policy, R&& range) {
+    return detail::sum(detail::thread_count(policy, std::ranges::size(range)), range)
+      .template as<U_TO>();
+  }
+
+  /*! @brief Arithmetic mean of the quantities in `range`, in their unit
+   *
+   * @param range Quantities to average
+   * @return The mean, or `std::errc::invalid_argument` if `range` is empty
+   */
+  template <QuantityRange R>
+  [[nodiscard]]
+  constexpr std::expected<range_quantity_t<R>, std::errc> mean(R&& range) {
+    return detail::mean(1, range);
+  }
+
+  //! See @ref quantify::mean, reduced according to `policy`
+  template <ExecutionPolicy P, QuantityRange R>
+  [[nodiscard]]
+  std::expected<range_quantity_t<R>, std::errc> mean(P&& policy, R&& range) {
+    return detail::mean(detail::thread_count(policy, std::ranges::size(range)), range);
+  }
+
+  /*! @brief Smallest and largest quantities in `range`
+   *
+   * @param range Quantities to search
+   * @return Both extremes, or `std::errc::invalid_argument` if `range` is empty
+   */
+  template <QuantityRange R>
+  [[nodiscard]]
+  constexpr std::expected<std::ranges::min_max_result<range_quantity_t<R>>, std::errc>
+  min_max(R&& range) {
+    return detail::min_max(1, range);
+  }
+
+  //! See @ref quantify::min_max, reduced according to `policy`
+  template <ExecutionPolicy P, QuantityRange R>
+  [[nodiscard]]
+  std::expected<std::ranges::min_max_result<range_quantity_t<R>>, std::errc>
+  min_max(P&& policy, R&& range) {
+    return detail::min_max(detail::thread_count(policy, std::ranges::size(range)), range);
+  }
+
+  /*! @brief Sum of the element-wise products of `lhs` and `rhs`
+   *
+   * The result has the unit of the product of one element of each range, e.g. the dot product
+   * of forces and distances is an energy. If both units belong to the same scale, `rhs` is
+   * converted into the unit of `lhs` once, on the result.
+   *
+   * @param lhs Left-hand side quantities
+   * @param rhs Right-hand side quantities
+   * @return The dot product, or `std::errc::invalid_argument` if `lhs` and `rhs` have different
+   *         sizes
+   */
+  template <QuantityRange RA, QuantityRange RB>
+    requires std::same_as<
+      typename range_quantity_t<RA>::data_type,
+      typename range_quantity_t<RB>::data_type>
+  [[nodiscard]]
+  constexpr std::expected<detail::dot_result_t<RA, RB>, std::errc> dot(RA&& lhs, RB&& rhs) {
+    return detail::dot(1, lhs, rhs);
+  }
+
+  //! See @ref quantify::dot, reduced according to `policy`
+  template <ExecutionPolicy P, QuantityRange RA, QuantityRange RB>
+    requires std::same_as<
+      typename range_quantity_t<RA>::data_type,
+      typename range_quantity_t<RB>::data_type>
+  [[nodiscard]]
+  std::expected<detail::dot_result_t<RA, RB>, std::errc> dot(P&& policy, RA&& lhs, RB&& rhs) {
+    return detail::dot(detail::thread_count(policy, std::ranges::size(lhs)), lhs, rhs);
+  }
+
+  /*! @brief Sum of the quantities in `range`, each multiplied by the scalar in `weights`
+   *
+   * @param range Quantities to add
+   * @param weights Weight of each quantity
+   * @return The weighted sum, or `std::errc::invalid_argument` if `range` and `weights` have
+   *         different sizes
+   */
+  template <QuantityRange R, WeightRange<typename range_quantity_t<R>::data_type> W>
+  [[nodiscard]]
+  constexpr std::expected<range_quantity_t<R>, std::errc> weighted_sum(R&& range, W&& weights) {
+    return detail::weighted_sum(1, range, weights);
+  }
+
+  //! See @ref quantify::weighted_sum, reduced according to `policy`
+  template <
+    ExecutionPolicy P,
+    QuantityRange   R,
+    WeightRange<typename range_quantity_t<R>::data_type> W>
+  [[nodiscard]]
+  std::expected<range_quantity_t<R>, std::errc> weighted_sum(P&& policy, R&& range, W&& weights) {
+    const unsigned threads = detail::thread_count(policy, std::ranges::size(range));
+    return detail::weighted_sum(threads, range, weights);
+  }
+} // namespace quantify
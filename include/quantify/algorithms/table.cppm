@@ -0,0 +1,357 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  table.cppm
+ *  \brief Lookup tables of quantities indexed by a key quantity, with interpolation
+ *
+ * Tables store their keys and every column of values as separate contiguous arrays, so a query
+ * touches two adjacent keys and two adjacent values per column and nothing else. Everything a
+ * query would otherwise recompute per segment, the inverse of its width and the tangents of the
+ * cubic interpolation, is computed once when rows are inserted.
+ */
+
+export module quantify.algorithms:table;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  //! Interpolation between the rows of a @ref quantify::table
+  enum class interpolation : std::uint8_t {
+    linear, //!< Straight line between the two rows around the key
+    cubic,  //!< Cubic Hermite spline, with finite-difference tangents at every row
+  };
+
+  /*! @brief Predicate that checks if `K` is a quantity that converts into unit `U`
+   *
+   * That is any unit of the scale of `U`, or of a scale with a conversion into it, e.g. a
+   * `celsius` key for a table indexed in `kelvin`.
+   */
+  template <typename K, typename U>
+  concept KeyQuantity = QuantityConcept<K> && requires(const K& key) { key.template as<U>(); };
+
+  //! @cond NEVER
+  namespace detail {
+    /*! Index `i` of the segment `[keys[i], keys[i + 1]]` that holds `x`, for
+     *  `keys[0] <= x <= keys[segments]`. The loop runs `log2(segments)` times whatever `x` is,
+     *  and its only data-dependent step compiles to a conditional move.
+     */
+    template <typename T>
+    constexpr std::size_t segment_of(const T* keys, std::size_t segments, double x) noexcept {
+      const T*    base = keys;
+      std::size_t n    = segments;
+      while (n > 1) {
+        const std::size_t half = n / 2;
+        base                   = base[half].value <= x ? base + half : base;
+        n -= half;
+      }
+      return static_cast<std::size_t>(base - keys);
+    }
+
+    //! Segment of a table and position of a key in it, from 0 at its first row to 1 at the next
+    struct table_position {
+      std::size_t segment;
+      double      t;
+    };
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Table of quantities in units `ValueUnits...` indexed by a key in unit `KeyUnit`
+   *
+   * Keys and each column of values are stored as contiguous arrays of `double`, in the units of
+   * the table, sorted by key. Queries take keys in any unit that converts into `KeyUnit` and
+   * interpolate every column between the two rows around the key. Keys outside of the table are
+   * clamped to its first and last rows. Batch queries locate each key once for all columns and
+   * fold the conversions of keys and results into a single constant each.
+   *
+   * Queries on a table with fewer than two rows fail with `std::errc::invalid_argument`.
+   *
+   * @tparam KeyUnit Unit of the keys
+   * @tparam ValueUnits Units of the columns of values
+   */
+  template <typename KeyUnit, typename... ValueUnits>
+  class table {
+    static_assert(sizeof...(ValueUnits) > 0, "Tables need at least one column of values.");
+
+    static constexpr std::size_t columns = sizeof...(ValueUnits);
+
+  public:
+    using key_type = quantity<KeyUnit, double>;
+    using row      = std::tuple<key_type, quantity<ValueUnits, double>...>;
+
+    //! Type of the values in column `C`
+    template <std::size_t C>
+    using value_type = std::tuple_element_t<C + 1, row>;
+
+    table() = default;
+
+    //! Table with `rows`, in any order. Of rows with equal keys, the last one is kept
+    table(std::initializer_list<row> rows) {
+      std::vector<row> sorted(rows);
+      std::ranges::stable_sort(sorted, {}, [](const row& r) { return std::get<0>(r).value; });
+      for (std::size_t i = 0; i < sorted.size(); ++i) {
+        if (i + 1 < sorted.size() && std::get<0>(sorted[i]) == std::get<0>(sorted[i + 1])) {
+          continue;
+        }
+        std::apply([this](const auto& key, const auto&... values) { append(key, values...); },
+                   sorted[i]);
+      }
+      rebuild();
+    }
+
+    /*! @brief Inserts a row, or replaces the values of the row with an equal key
+     *
+     * The key and the values are converted into the units of the table. Takes `O(size())`.
+     */
+    template <KeyQuantity<KeyUnit> K, QuantityConcept... Vs>
+      requires(sizeof...(Vs) == columns)
+    void insert(const K& key, const Vs&... values) {
+      const double k     = static_cast<double>(key.template as<KeyUnit>().value);
+      const auto   where = std::ranges::lower_bound(keys_, k, {}, &key_type::value);
+      const auto   i     = static_cast<std::size_t>(where - keys_.begin());
+      if (where != keys_.end() && where->value == k) {
+        assign_row(i, std::make_index_sequence<columns>{}, values...);
+      } else {
+        keys_.insert(where, key_type{k});
+        insert_row(i, std::make_index_sequence<columns>{}, values...);
+      }
+      rebuild();
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return keys_.size();
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+      return keys_.empty();
+    }
+
+    //! Keys of the table, sorted
+    [[nodiscard]]
+    std::span<const key_type> keys() const noexcept {
+      return keys_;
+    }
+
+    //! Values of column `C`, in the order of the keys
+    template <std::size_t C>
+    [[nodiscard]]
+    std::span<const value_type<C>> column() const noexcept {
+      return std::get<C>(values_);
+    }
+
+    //! Values of every column at `key`
+    template <interpolation I = interpolation::linear, KeyQuantity<KeyUnit> K>
+    [[nodiscard]]
+    std::expected<std::tuple<quantity<ValueUnits, double>...>, std::errc>
+    lookup(const K& key) const noexcept {
+      const auto p = locate(key);
+      if (!p) [[unlikely]] {
+        return std::unexpected{p.error()};
+      }
+      return lookup_all<I>(*p, std::make_index_sequence<columns>{});
+    }
+
+    //! Value of column `C` at `key`
+    template <std::size_t C, interpolation I = interpolation::linear, KeyQuantity<KeyUnit> K>
+    [[nodiscard]]
+    std::expected<value_type<C>, std::errc> lookup(const K& key) const noexcept {
+      const auto p = locate(key);
+      if (!p) [[unlikely]] {
+        return std::unexpected{p.error()};
+      }
+      return value_type<C>{interpolate<C, I>(*p)};
+    }
+
+    /*! @brief Values of every column at each of `keys`, written into `out...` in order
+     *
+     * Each range of `out...` holds quantities of the scale of its column, whose conversion is
+     * folded once for the whole batch. Every range of `out...` must have as many elements as
+     * `keys`, otherwise nothing is written and `std::errc::invalid_argument` is returned.
+     */
+    template <
+      interpolation I = interpolation::linear,
+      std::ranges::contiguous_range Keys,
+      std::ranges::contiguous_range... Outs>
+      requires KeyQuantity<std::ranges::range_value_t<Keys>, KeyUnit> &&
+               (sizeof...(Outs) == columns) &&
+               (SameScale<typename std::ranges::range_value_t<Outs>::unit, ValueUnits> && ...)
+    [[nodiscard]]
+    std::expected<void, std::errc> lookup_into(const Keys& keys, Outs&&... out) const noexcept {
+      const std::size_t n = std::ranges::size(keys);
+      if (!queryable() || ((std::ranges::size(out) != n) || ...)) [[unlikely]] {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      const auto* k = std::ranges::data(keys);
+      for (std::size_t i = 0; i < n; ++i) {
+        const detail::table_position p = position(k[i]);
+        store_all<I>(p, i, std::make_index_sequence<columns>{}, std::ranges::data(out)...);
+      }
+      return {};
+    }
+
+    //! Values of column `C` at each of `keys`, see the overload for every column
+    template <
+      std::size_t C,
+      interpolation I = interpolation::linear,
+      std::ranges::contiguous_range Keys,
+      std::ranges::contiguous_range Out>
+      requires KeyQuantity<std::ranges::range_value_t<Keys>, KeyUnit> &&
+               SameScale<typename std::ranges::range_value_t<Out>::unit,
+                         typename value_type<C>::unit>
+    [[nodiscard]]
+    std::expected<void, std::errc> lookup_into(const Keys& keys, Out&& out) const noexcept {
+      const std::size_t n = std::ranges::size(keys);
+      if (!queryable() || std::ranges::size(out) != n) [[unlikely]] {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      const auto* k = std::ranges::data(keys);
+      auto*       o = std::ranges::data(out);
+      for (std::size_t i = 0; i < n; ++i) {
+        store<C, I>(position(k[i]), o[i]);
+      }
+      return {};
+    }
+
+  private:
+    std::vector<key_type>                                    keys_{};
+    std::tuple<std::vector<quantity<ValueUnits, double>>...> values_{};
+    //! `1 / (keys_[i + 1] - keys_[i])`, for every segment
+    std::vector<double> inverse_width_{};
+    //! Derivative of each column with respect to the key, at every row
+    std::array<std::vector<double>, columns> tangents_{};
+
+    template <typename... Vs>
+    void append(const key_type& key, const Vs&... values) {
+      keys_.push_back(key);
+      [&]<std::size_t... C>(std::index_sequence<C...>) {
+        (std::get<C>(values_).push_back(values), ...);
+      }(std::make_index_sequence<columns>{});
+    }
+
+    template <std::size_t... C, typename... Vs>
+    void assign_row(std::size_t i, std::index_sequence<C...>, const Vs&... values) {
+      ((std::get<C>(values_)[i] = values.template as<typename value_type<C>::unit>()), ...);
+    }
+
+    template <std::size_t... C, typename... Vs>
+    void insert_row(std::size_t i, std::index_sequence<C...>, const Vs&... values) {
+      (std::get<C>(values_).insert(
+         std::get<C>(values_).begin() + static_cast<std::ptrdiff_t>(i),
+         values.template as<typename value_type<C>::unit>()
+       ),
+       ...);
+    }
+
+    //! Recomputes the widths of the segments and the tangents at every row
+    void rebuild() {
+      const std::size_t n = keys_.size();
+      inverse_width_.resize(n > 0 ? n - 1 : 0);
+      for (std::size_t i = 0; i + 1 < n; ++i) {
+        inverse_width_[i] = 1.0 / (keys_[i + 1].value - keys_[i].value);
+      }
+      [&]<std::size_t... C>(std::index_sequence<C...>) {
+        (rebuild_tangents<C>(), ...);
+      }(std::make_index_sequence<columns>{});
+    }
+
+    template <std::size_t C>
+    void rebuild_tangents() {
+      const auto&       v        = std::get<C>(values_);
+      auto&             tangents = std::get<C>(tangents_);
+      const std::size_t n        = v.size();
+      tangents.assign(n, 0.0);
+      if (n < 2) {
+        return;
+      }
+      const auto secant = [&](std::size_t i) {
+        return (v[i + 1].value - v[i].value) * inverse_width_[i];
+      };
+      tangents[0]     = secant(0);
+      tangents[n - 1] = secant(n - 2);
+      for (std::size_t i = 1; i + 1 < n; ++i) {
+        tangents[i] = 0.5 * (secant(i - 1) + secant(i));
+      }
+    }
+
+    //! Whether the table has a segment to interpolate in
+    [[nodiscard]]
+    bool queryable() const noexcept {
+      return keys_.size() >= 2;
+    }
+
+    //! Position of `key`, or an error if the table has fewer than two rows
+    template <typename K>
+    std::expected<detail::table_position, std::errc> locate(const K& key) const noexcept {
+      if (!queryable()) [[unlikely]] {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      return position(key);
+    }
+
+    //! Position of `key`, for a @ref queryable table
+    template <typename K>
+    detail::table_position position(const K& key) const noexcept {
+      const double      x = std::clamp(
+        static_cast<double>(key.template as<KeyUnit>().value), keys_.front().value,
+        keys_.back().value
+      );
+      const std::size_t i = detail::segment_of(keys_.data(), keys_.size() - 1, x);
+      return {i, (x - keys_[i].value) * inverse_width_[i]};
+    }
+
+    //! Value of column `C` at `p`, in the unit of the column
+    template <std::size_t C, interpolation I>
+    double interpolate(const detail::table_position& p) const noexcept {
+      const auto&   v  = std::get<C>(values_);
+      const double  v0 = v[p.segment].value;
+      const double  v1 = v[p.segment + 1].value;
+      const double& t  = p.t;
+      if constexpr (I == interpolation::linear) {
+        return v0 + t * (v1 - v0);
+      } else {
+        const auto&  tangents = std::get<C>(tangents_);
+        const double width    = keys_[p.segment + 1].value - keys_[p.segment].value;
+        const double m0       = tangents[p.segment] * width;
+        const double m1       = tangents[p.segment + 1] * width;
+        const double t2       = t * t;
+        const double t3       = t2 * t;
+        return (2.0 * t3 - 3.0 * t2 + 1.0) * v0 + (t3 - 2.0 * t2 + t) * m0 +
+               (3.0 * t2 - 2.0 * t3) * v1 + (t3 - t2) * m1;
+      }
+    }
+
+    template <interpolation I, std::size_t... C>
+    std::tuple<quantity<ValueUnits, double>...>
+    lookup_all(const detail::table_position& p, std::index_sequence<C...>) const noexcept {
+      return {value_type<C>{interpolate<C, I>(p)}...};
+    }
+
+    template <std::size_t C, interpolation I, typename Out>
+    void store(const detail::table_position& p, Out& out) const noexcept {
+      using T                 = typename Out::data_type;
+      using U                 = typename value_type<C>::unit;
+      constexpr exact_ratio f = conversion_factor_v<U, typename Out::unit>;
+      out.value               = static_cast<T>(apply_factor<f>(interpolate<C, I>(p)));
+    }
+
+    template <interpolation I, std::size_t... C, typename... Outs>
+    void store_all(
+      const detail::table_position& p, std::size_t i, std::index_sequence<C...>, Outs*... out
+    ) const noexcept {
+      (store<C, I>(p, out[i]), ...);
+    }
+  };
+} // namespace quantify
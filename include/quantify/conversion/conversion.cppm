@@ -0,0 +1,112 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  conversion.cppm
+ *  \brief Precomputed conversion coefficients between units
+ *
+ */
+
+export module quantify.conversion;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  /*! @brief Predicate that checks if quantities of unit `U_FROM` can be converted to `U_TO`
+   */
+  template <typename U_FROM, typename U_TO, typename T>
+  concept ConvertibleTo = requires(const quantity<U_FROM, T>& q) { q.template as<U_TO>(); };
+
+  /*! @brief Predicate that checks if `U_FROM` can be converted to `U_TO` by an exact affine map
+   *
+   * That is the case for units of the same scale, and for units whose scales are related by
+   * `SCALE_AFFINE_CONVERSION`.
+   */
+  template <typename U_FROM, typename U_TO>
+  concept LinearlyConvertibleTo =
+    SameScale<U_FROM, U_TO> || AffineScales<typename U_FROM::scale, typename U_TO::scale>;
+
+  //! @cond NEVER
+  namespace detail {
+    template <typename U_FROM, typename U_TO>
+    consteval affine_map linear_conversion_map() noexcept {
+      if constexpr (SameScale<U_FROM, U_TO>) {
+        return affine_map{conversion_factor_v<U_FROM, U_TO>};
+      } else {
+        return affine_conversion<U_FROM, U_TO>::map;
+      }
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Conversion from `U_FROM` to `U_TO` folded into the map `to = scale * from + offset`
+   *
+   * The map is the exact one @ref quantify::quantity::as() uses: the conversion factor between
+   * units of the same scale, with a zero offset, or the folded @ref quantify::affine_conversion
+   * between scales related by `SCALE_AFFINE_CONVERSION`. Both coefficients are rounded to `T`
+   * once, so a single multiplication and addition yields the same result as
+   * @ref quantify::quantity::as() up to that rounding. Conversions declared with
+   * `SCALE_CONVERSION` are arbitrary functions and have no such map.
+   *
+   * Only available for floating point data types.
+   *
+   * @tparam U_FROM Source unit
+   * @tparam U_TO Target unit
+   * @tparam T Underlying data type
+   */
+  template <typename U_FROM, typename U_TO, typename T>
+    requires std::is_floating_point_v<T> && LinearlyConvertibleTo<U_FROM, U_TO>
+  struct linear_conversion {
+    //! Exact map, see @ref quantify::affine_map
+    static constexpr affine_map map = detail::linear_conversion_map<U_FROM, U_TO>();
+
+    static constexpr T offset = map.offset.template as<T>();
+    static constexpr T scale  = map.scale.template as<T>();
+
+    //! Whether or not the conversion has a non-zero offset
+    static constexpr bool is_affine = map.offset.num != 0;
+
+    [[nodiscard]]
+    static constexpr T apply(T value) noexcept {
+      if constexpr (is_affine) {
+        return value * scale + offset;
+      } else {
+        return value * scale;
+      }
+    }
+  };
+
+  /*! @brief Converts `q` into unit `U_TO`, rounding the result according to `R`
+   *
+   * @ref quantify::quantity::as() truncates integral values towards zero. This overload
+   * computes the same exact conversion in a wider intermediate and rounds it with the selected
+   * mode instead, e.g. `round_as<meter, rounding::to_nearest>(Q<millimeter, int>{1500})` yields
+   * `2 m`. Representation policies such as @ref quantify::saturating carry their own rounding
+   * mode and are converted with @ref quantify::quantity::as().
+   *
+   * @tparam U_TO Target unit
+   * @tparam R Rounding mode
+   */
+  template <typename U_TO, rounding R, typename U, typename T>
+    requires std::is_integral_v<T> &&
+             (SameScale<U, U_TO> || AffineScales<typename U::scale, typename U_TO::scale>)
+  [[nodiscard]]
+  constexpr quantity<U_TO, T> round_as(const quantity<U, T>& q) noexcept {
+    if constexpr (SameScale<U, U_TO>) {
+      return {apply_factor<conversion_factor_v<U, U_TO>, R>(q.value)};
+    } else {
+      return {affine_conversion<U, U_TO>::template apply<T, R>(q.value)};
+    }
+  }
+} // namespace quantify
@@ -0,0 +1,182 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  affine.cppm
+ *  \brief Affine conversions between scales, composed and folded at compile-time
+ *
+ * Scales related by an affine map `to = scale * from + offset`, such as the temperature scales,
+ * are declared as edges of a conversion tree with `SCALE_AFFINE_CONVERSION`: every scale names
+ * at most one parent scale and the map from its parent into itself. A conversion between any two
+ * scales of the same tree goes up from the source scale to the root and back down to the target
+ * scale; the maps along that path and the factors of both units are folded into a single exact
+ * affine map, so converting a value costs one multiplication and one addition.
+ */
+
+export module quantify.core:affine;
+import std;
+import :preface;
+import :factor;
+
+export namespace quantify {
+  /*! @brief Exact affine map `x -> scale * x + offset`
+   */
+  struct affine_map {
+    exact_ratio scale{};
+    exact_ratio offset{0, 1};
+
+    [[nodiscard]]
+    constexpr bool overflow() const noexcept {
+      return scale.overflow || offset.overflow;
+    }
+
+    //! Map that undoes this one
+    [[nodiscard]]
+    constexpr affine_map inverse() const noexcept {
+      return {scale.inverse(), -offset / scale};
+    }
+
+    //! Map that applies `first` and then `second`
+    friend constexpr affine_map
+    operator>>(const affine_map& first, const affine_map& second) noexcept {
+      return {second.scale * first.scale, second.scale * first.offset + second.offset};
+    }
+
+    friend constexpr bool operator==(const affine_map& lhs, const affine_map& rhs) noexcept =
+      default;
+  };
+
+  /*! @brief Edge of the affine conversion tree into scale `S`
+   *
+   * Specialized by `SCALE_AFFINE_CONVERSION` with a `parent` scale and the `map` that converts
+   * values in the base unit of `parent` into values in the base unit of `S`.
+   *
+   * @tparam S Scale
+   */
+  template <typename S>
+  struct affine_scale_edge {};
+
+  //! @cond NEVER
+  namespace detail {
+    template <typename S>
+    concept HasAffineParent = requires {
+      typename affine_scale_edge<S>::parent;
+      affine_scale_edge<S>::map;
+    };
+
+    //! Root of the tree `S` belongs to, and map from `S` into its root
+    template <typename S>
+    struct affine_root {
+      using type = S;
+
+      static constexpr affine_map to_root = {};
+    };
+
+    template <HasAffineParent S>
+    struct affine_root<S> {
+      using parent = typename affine_scale_edge<S>::parent;
+      using type   = typename affine_root<parent>::type;
+
+      static constexpr affine_map to_root =
+        affine_scale_edge<S>::map.inverse() >> affine_root<parent>::to_root;
+    };
+
+    //! `value * scale + offset`, see @ref quantify::affine_conversion::apply
+    template <exact_ratio scale, exact_ratio offset, rounding R = rounding::toward_zero, typename T>
+    [[nodiscard]]
+    constexpr T apply_affine(const T& value) noexcept {
+      if constexpr (offset.num == 0) {
+        return apply_factor<scale, R>(value);
+      } else if constexpr (std::is_integral_v<T>) {
+        // value * scale + offset == (value * num + addend) / den
+        constexpr exact_int den =
+          scale.den / exact_ratio::gcd(scale.den, offset.den) * offset.den;
+        constexpr exact_int num    = scale.num * (den / scale.den);
+        constexpr exact_int addend = offset.num * (den / offset.den);
+        using intermediate         = std::conditional_t<
+          sizeof(T) <= sizeof(std::int32_t) && detail::fits_in<std::int32_t>(num) &&
+            detail::fits_in<std::int32_t>(addend) && detail::fits_in<std::int32_t>(den),
+          std::int64_t,
+          exact_int>;
+        return static_cast<T>(detail::divide_rounded<R>(
+          static_cast<intermediate>(value) * static_cast<intermediate>(num) +
+            static_cast<intermediate>(addend),
+          static_cast<intermediate>(den)
+        ));
+      } else if constexpr (representation_traits<T>::is_specialized) {
+        // Scaled and offset exactly by the representation, and rounded once
+        return representation_traits<T>::template scale<scale, offset>(value);
+      } else if constexpr (std::is_floating_point_v<T>) {
+        constexpr T b = offset.template as<T>();
+        if constexpr (scale.num == scale.den) {
+          return value + b;
+        } else {
+          constexpr T a = scale.template as<T>();
+          return value * a + b;
+        }
+      } else {
+        return value * scale.template as<T>() + offset.template as<T>();
+      }
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Predicate that checks if two different scales are related by affine conversions
+   *
+   * That is, if both belong to the same tree of `SCALE_AFFINE_CONVERSION` edges.
+   */
+  template <typename S_FROM, typename S_TO>
+  concept AffineScales =
+    !std::same_as<S_FROM, S_TO> &&
+    (detail::HasAffineParent<S_FROM> || detail::HasAffineParent<S_TO>) &&
+    std::same_as<
+      typename detail::affine_root<S_FROM>::type,
+      typename detail::affine_root<S_TO>::type>;
+
+  /*! @brief Conversion from `U_FROM` to `U_TO`, whose scales are related by affine conversions
+   *
+   * The factor of `U_FROM`, the maps along the path between both scales and the factor of
+   * `U_TO` are folded into a single exact map at compile-time.
+   *
+   * @tparam U_FROM Source unit
+   * @tparam U_TO Target unit
+   */
+  template <typename U_FROM, typename U_TO>
+    requires AffineScales<typename U_FROM::scale, typename U_TO::scale>
+  struct affine_conversion {
+    static constexpr affine_map map =
+      affine_map{unit_factor_v<U_FROM>}
+      >> detail::affine_root<typename U_FROM::scale>::to_root
+      >> detail::affine_root<typename U_TO::scale>::to_root.inverse()
+      >> affine_map{unit_factor_v<U_TO>.inverse()};
+
+    static_assert(
+      !map.overflow(),
+      "The conversion between these units cannot be represented exactly in 128 bits."
+    );
+
+    /*! @brief Converts `value`
+     *
+     * Floating point values are multiplied and offset by the correctly rounded coefficients.
+     * Integral values are converted exactly and rounded according to `R`, in 64-bit arithmetic
+     * when that is provably enough and in 128-bit arithmetic otherwise. Data types with a
+     * @ref representation_traits specialization are scaled and offset by it in a single step.
+     */
+    template <typename T, rounding R = rounding::toward_zero>
+    [[nodiscard]]
+    static constexpr T apply(const T& value) noexcept {
+      return detail::apply_affine<map.scale, map.offset, R>(value);
+    }
+  };
+} // namespace quantify
@@ -0,0 +1,140 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  chrono.cppm
+ *  \brief Mapping of `std::chrono::duration` periods onto units
+ *
+ */
+
+module;
+#include "quantify/unit_macros.h"
+export module quantify.core:chrono;
+import std;
+import :preface;
+import :factor;
+import :unit_list;
+
+export namespace quantify {
+  /*! @brief Unit that a `std::chrono::duration` with period `Period` maps onto
+   *
+   * Unspecialized by default. A time scale specializes it for every `std::ratio` with
+   * `CHRONO_SCALE`, which is what enables the conversions between `std::chrono::duration` and
+   * @ref quantify::quantity.
+   *
+   * @tparam Period `std::ratio` of seconds per tick
+   */
+  template <typename Period>
+  struct duration_unit { };
+
+  //! See @ref quantify::duration_unit
+  template <typename Period>
+  using duration_unit_t = typename duration_unit<Period>::type;
+
+  //! Checks whether durations with period `Period` map onto a unit
+  template <typename Period>
+  concept ChronoPeriod = requires { typename duration_unit<Period>::type; };
+
+  //! @cond NEVER
+  namespace detail {
+    consteval std::size_t decimal_digits(std::intmax_t value) noexcept {
+      std::size_t digits = 1;
+      for (; value >= 10; value /= 10) {
+        ++digits;
+      }
+      return digits;
+    }
+
+    //! Decimal representation of a non-negative `Value`
+    template <std::intmax_t Value>
+    consteval auto decimal_string() noexcept {
+      fixed_string<decimal_digits(Value)> str{};
+      std::intmax_t                       value = Value;
+      for (std::size_t i = str.size(); i > 0; --i, value /= 10) {
+        str.data[i - 1] = static_cast<char>('0' + value % 10);
+      }
+      return str;
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Unit of the scale of `Base` whose factor is the period of a `std::chrono::duration`
+   *
+   * Stands in for periods that no unit of the scale matches, such as the tick of a clock. Its
+   * symbol is the period times the symbol of `Base`, e.g. `(1/60)s`.
+   *
+   * @tparam Base Unit with a factor of one that the period is expressed in
+   * @tparam Period `std::ratio` of base units per tick
+   */
+  template <typename Base, typename Period>
+  struct period_unit {
+    using scale = typename Base::scale;
+    template <typename T>
+    using factor = ratio<T, Period::num, Period::den>;
+    using reduce = period_unit;
+    UNIT_SYMBOL(
+      "(" + detail::decimal_string<Period::num>() + "/" + detail::decimal_string<Period::den>() +
+      ")" + Base::symbol_literal()
+    )
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    template <exact_ratio F, typename Fallback, typename... Units>
+    struct unit_with_factor {
+      using type = Fallback;
+    };
+
+    template <exact_ratio F, typename Fallback, typename U, typename... Units>
+    struct unit_with_factor<F, Fallback, U, Units...> {
+      using type = std::conditional_t<
+        unit_factor_v<U> == F, U, typename unit_with_factor<F, Fallback, Units...>::type>;
+    };
+
+    template <typename List, typename Base, typename Period>
+    struct chrono_unit;
+
+    template <typename... Units, typename Base, typename Period>
+    struct chrono_unit<unit_list<Units...>, Base, Period> {
+      static_assert(unit_factor_v<Base> == exact_ratio{}, "The base unit must have a factor of 1.");
+      using type = typename unit_with_factor<
+        exact_ratio{Period::num, Period::den}.reduced(), period_unit<Base, Period>,
+        Units...>::type;
+    };
+
+    //! First unit in `List` whose factor equals `Period`, or a `period_unit` if there is none
+    template <typename List, typename Base, typename Period>
+    using chrono_unit_t = typename chrono_unit<List, Base, Period>::type;
+
+    //! Whether converting `From` values into `To` values by `F` is exact, by the same rules as
+    //! the implicit conversions between `std::chrono::duration` types
+    template <typename From, typename To, exact_ratio F>
+    constexpr bool lossless_duration_conversion =
+      std::chrono::treat_as_floating_point_v<To> ||
+      (!std::chrono::treat_as_floating_point_v<From> && F.den == 1);
+
+    //! `value` converted into `To` by `F`, scaled in the common type of `From` and `To` so that
+    //! no precision is lost before the factor is applied
+    template <exact_ratio F, typename To, typename From>
+    constexpr To convert_ticks(const From& value) noexcept {
+      if constexpr (requires { typename std::common_type_t<From, To>; }) {
+        using C = std::common_type_t<From, To>;
+        return static_cast<To>(apply_factor<F>(static_cast<C>(value)));
+      } else {
+        return apply_factor<F>(static_cast<To>(value));
+      }
+    }
+  } // namespace detail
+  //! @endcond
+} // namespace quantify
@@ -20,7 +20,9 @@
 
 export module quantify.core:concepts;
 import :reduce_rules;
+import :canonical;
 import :preface;
+import :affine;
 
 namespace quantify {
   export template<typename U_FROM, typename U_TO, typename T>
@@ -31,75 +33,12 @@ namespace quantify {
   // concept ConvertibleScales = requires { scale_conversion_t<S_FROM, S_TO>::template forward<U_FROM, U_TO, T>; }
                               // || requires { scale_conversion_t<S_TO, S_FROM>::template backward<U_FROM, U_TO, T>; };
   export template<typename S_FROM, typename S_TO, typename U_FROM, typename U_TO, typename T>
-  concept ConvertibleScales = requires { scale_conversion_t<S_FROM, S_TO>{}; }
+  concept ConvertibleScales = AffineScales<S_FROM, S_TO>
+                              || requires { scale_conversion_t<S_FROM, S_TO>{}; }
                               || requires { scale_conversion_t<S_TO, S_FROM>{}; };
 
-  // export {
-  //! @cond NEVER
-    template <typename...>
-    struct compare {
-      template <typename...>
-      struct equals: std::false_type {};
-    };
-
-    template <typename A, typename B>
-    using compare_eq = typename compare<A>::template equals<B>;
-
-    template <typename Arg1>
-    struct compare<Arg1> {
-      template <typename...>
-      struct equals;
-
-      template <typename Arg2>
-      struct equals<Arg2> {
-        constexpr static bool value = std::is_same_v<Arg1, Arg2>;
-      };
-    };
-
-    template <template <typename...> typename Pack, typename Arg1>
-    struct compare<Pack<Arg1>> {
-      template <typename...>
-      struct equals;
-
-      template <typename Arg2>
-      struct equals<Pack<Arg2>> {
-        constexpr static bool value = compare<Arg1>::template equals<Arg2>::value;
-      };
-
-      template <typename Any>
-      struct equals<Any>: std::false_type {};
-    };
-
-    template <template <typename...> typename Pack, typename... Args1>
-    struct compare<Pack<Args1...>> {
-      template <typename...>
-      struct equals;
-
-      template <typename Arg2, typename... Args2>
-        requires (sizeof...(Args1) == (sizeof...(Args2) + 1) && (compare_eq<Arg2, Args1>::value || ...))
-      struct equals<Pack<Arg2, Args2...>> {
-      private:
-        using tmp = typename packtl::take_one_out_w_predicate<typename compare<Arg2>::template equals<void>, packtl::pack<Args1...>>::type;
-      public:
-        constexpr static bool value = compare_eq<tmp, packtl::pack<Args2...>>::value;
-      };
-
-      template <typename Arg2, typename... Args2>
-        requires (sizeof...(Args1) == (sizeof...(Args2) + 1) && (!compare_eq<Arg2, Args1>::value && ...))
-      struct equals<Pack<Arg2, Args2...>>: std::false_type { };
-
-      template <typename... Args2>
-        requires (sizeof...(Args1) != sizeof...(Args2))
-      struct equals<Pack<Args2...>>: std::false_type { };
-
-      template <typename Any>
-      struct equals<Any>: std::false_type {};
-    };
-  //! @endcond
-  // }
-
   export template<typename U1, typename U2>
-  concept CompareScales = compare_eq<typename reduce_scale<U1>::type, typename reduce_scale<U2>::type>::value;
+  concept CompareScales = same_dimensions_v<U1, U2>;
 
   export template<typename U1, typename U2>
   concept SameScale = CompareScales<typename U1::scale, typename U2::scale>;
@@ -149,4 +88,14 @@ namespace quantify {
    */
   export template <typename T>
   concept QuantityConcept = is_quantity_v<T>;
+
+  /*! @brief Predicate that checks if a type can be the scalar operand of a quantity operator
+   *
+   * That is, if it is neither a quantity nor a lazy quantity expression, which declares a
+   * `quantity_expression` member type and provides its own operators.
+   *
+   * @tparam T
+   */
+  export template <typename T>
+  concept ScalarOperand = !QuantityConcept<T> && !requires { typename T::quantity_expression; };
 }
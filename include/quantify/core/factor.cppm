@@ -0,0 +1,289 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  factor.cppm
+ *  \brief Exact, compile-time folded conversion factors
+ *
+ */
+
+export module quantify.core:factor;
+import std;
+import :preface;
+
+export namespace quantify {
+  /*! @brief Exact factor of unit `U` relative to the base unit of its scale
+   *
+   * Simple units take it from their `factor<T>` ratio. Products and fractions of units fold
+   * the factors of their operands in 128-bit rational arithmetic, reducing by the gcd at every
+   * step.
+   *
+   * @tparam U Unit
+   */
+  template <typename U>
+  struct unit_factor {
+    static constexpr exact_ratio value = exact_ratio{
+      static_cast<exact_int>(U::template factor<exact_int>::numerator),
+      static_cast<exact_int>(U::template factor<exact_int>::denominator),
+    }.reduced();
+  };
+
+  template <typename... Products>
+  struct unit_factor<mul<Products...>> {
+    static constexpr exact_ratio value = (exact_ratio{} * ... * unit_factor<Products>::value);
+    static_assert(
+      !value.overflow, "The factor of this unit cannot be represented exactly in 128 bits."
+    );
+  };
+
+  template <typename Numerator, typename Denominator>
+  struct unit_factor<frac<Numerator, Denominator>> {
+    static constexpr exact_ratio value =
+      unit_factor<Numerator>::value / unit_factor<Denominator>::value;
+    static_assert(
+      !value.overflow, "The factor of this unit cannot be represented exactly in 128 bits."
+    );
+  };
+
+  //! See @ref quantify::unit_factor
+  template <typename U>
+  constexpr exact_ratio unit_factor_v = unit_factor<U>::value;
+
+  /*! @brief `ratio` holding the folded factor of `U` in data type `T`
+   *
+   * Backs the `factor<T>` member of `mul` and `frac`. Being a class template it is only folded
+   * once `factor<T>` is named, so products and fractions of scales can still be instantiated.
+   */
+  template <typename T, typename U>
+  struct unit_ratio {
+    using type = ratio<T, unit_factor_v<U>.num, unit_factor_v<U>.den>;
+  };
+
+  /*! @brief Exact factor that converts values in unit `U_FROM` into values in unit `U_TO`
+   *
+   * Both units must belong to the same scale.
+   *
+   * @tparam U_FROM Source unit
+   * @tparam U_TO Target unit
+   */
+  template <typename U_FROM, typename U_TO>
+  struct conversion_factor {
+    static constexpr exact_ratio value = unit_factor_v<U_FROM> / unit_factor_v<U_TO>;
+    static_assert(
+      !value.overflow,
+      "The conversion factor between these units cannot be represented exactly in 128 bits."
+    );
+  };
+
+  //! See @ref quantify::conversion_factor
+  template <typename U_FROM, typename U_TO>
+  constexpr exact_ratio conversion_factor_v = conversion_factor<U_FROM, U_TO>::value;
+
+  /*! @brief Rounding mode of conversions that cannot be represented exactly in an integral type
+   */
+  enum class rounding : std::uint8_t {
+    toward_zero,         //!< Truncate, like the built-in integer division
+    to_nearest,          //!< Round to the nearest value, ties away from zero
+    toward_infinity,     //!< Round up
+    toward_neg_infinity, //!< Round down
+  };
+
+  /*! @brief Customization point for data types that are not built-in arithmetic types
+   *
+   * A specialization with `is_specialized = true` provides
+   * `template <exact_ratio F, exact_ratio O = {0, 1}> static constexpr T scale(const T&)`,
+   * which computes `value * F + O` and which @ref apply_factor and affine conversions use
+   * instead of multiplying and dividing in `T` by the numerator and denominator of the factor.
+   * The representation policies in `:representation` specialize it to scale and offset their
+   * integers in a wider intermediate, rounding once with their own rounding and overflow
+   * behaviour.
+   *
+   * @tparam T Data type
+   */
+  template <typename T>
+  struct representation_traits {
+    static constexpr bool is_specialized = false;
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    template <typename T>
+    constexpr bool fits_in(exact_int value) noexcept {
+      return value >= static_cast<exact_int>(std::numeric_limits<T>::lowest()) &&
+             value <= static_cast<exact_int>(std::numeric_limits<T>::max());
+    }
+
+    //! `n / d` rounded according to `R`, for a positive `d`
+    template <rounding R, typename I>
+    constexpr I divide_rounded(I n, I d) noexcept {
+      const I q = n / d;
+      const I r = n % d;
+      if constexpr (R == rounding::toward_zero) {
+        return q;
+      } else if constexpr (R == rounding::toward_infinity) {
+        return r > 0 ? q + 1 : q;
+      } else if constexpr (R == rounding::toward_neg_infinity) {
+        return r < 0 ? q - 1 : q;
+      } else {
+        const I magnitude = r < 0 ? -r : r;
+        if (magnitude == 0 || magnitude < d - magnitude) {
+          return q;
+        }
+        return n < 0 ? q - 1 : q + 1;
+      }
+    }
+
+    /*! Narrowest integer wide enough to hold any value of `T` multiplied by `factor`: 64 bits
+     *  when `T` has at most 32 bits and `factor` fits in 31, 128 bits otherwise.
+     */
+    template <typename T, exact_int factor>
+    using product_int_t = std::conditional_t<
+      (sizeof(T) <= sizeof(std::int32_t) && fits_in<std::int32_t>(factor)),
+      std::int64_t,
+      exact_int>;
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Multiplies `value` by the exact factor `F`
+   *
+   * The factor is folded at compile-time so that, at run-time, this is a single multiplication
+   * when `F` is an integer, a single division when `1/F` is an integer, and a single
+   * multiplication by a correctly rounded constant otherwise. Integral data types use a wider
+   * intermediate when both operations are needed so that nothing overflows or truncates early:
+   * 64 bits when that is provably enough, 128 bits otherwise. The result is rounded according
+   * to `R`; an integral result outside the range of `T` wraps around modulo 2^N instead of
+   * overflowing. Data types with a @ref representation_traits specialization scale themselves.
+   *
+   * @tparam F Factor to apply
+   * @tparam R Rounding mode of integral data types
+   * @param value Value to scale
+   */
+  template <exact_ratio F, rounding R = rounding::toward_zero, typename T>
+  [[nodiscard]]
+  constexpr T apply_factor(const T& value) noexcept {
+    static_assert(!F.overflow, "The conversion factor cannot be represented exactly in 128 bits.");
+
+    if constexpr (F.num == F.den) {
+      return value;
+    } else if constexpr (representation_traits<T>::is_specialized) {
+      return representation_traits<T>::template scale<F>(value);
+    } else if constexpr (std::is_integral_v<T>) {
+      if constexpr (F.den == 1) {
+        static_assert(
+          detail::fits_in<T>(F.num), "The conversion factor does not fit in this type."
+        );
+        using intermediate = detail::product_int_t<T, F.num>;
+        return static_cast<T>(static_cast<intermediate>(value) * static_cast<intermediate>(F.num));
+      } else if constexpr (F.num == 1) {
+        if constexpr (!detail::fits_in<T>(F.den)) {
+          return static_cast<T>(detail::divide_rounded<R>(static_cast<exact_int>(value), F.den));
+        } else {
+          return static_cast<T>(detail::divide_rounded<R>(value, static_cast<T>(F.den)));
+        }
+      } else {
+        static_assert(
+          detail::fits_in<std::int64_t>(F.num) && detail::fits_in<std::int64_t>(F.den),
+          "The conversion factor does not fit in a 64 bit intermediate."
+        );
+        using intermediate = detail::product_int_t<T, F.num>;
+        return static_cast<T>(detail::divide_rounded<R>(
+          static_cast<intermediate>(value) * static_cast<intermediate>(F.num),
+          static_cast<intermediate>(F.den)
+        ));
+      }
+    } else if constexpr (std::is_floating_point_v<T>) {
+      if constexpr (F.den == 1) {
+        return value * static_cast<T>(F.num);
+      } else if constexpr (F.num == 1) {
+        return value / static_cast<T>(F.den);
+      } else {
+        constexpr T factor = F.template as<T>();
+        return value * factor;
+      }
+    } else {
+      return value * ratio<T, F.num, F.den>::numerator / ratio<T, F.num, F.den>::denominator;
+    }
+  }
+
+  //! @cond NEVER
+  namespace detail {
+    //! Whether comparing a `T1` with a `T2` scaled by `F` has to cross-multiply
+    template <exact_ratio F, typename T1, typename T2>
+    constexpr bool cross_multiplies =
+      F.num != F.den && std::is_integral_v<T1> && std::is_integral_v<T2> && sizeof(T1) <= 8 &&
+      sizeof(T2) <= 8 && fits_in<std::int64_t>(F.num) && fits_in<std::int64_t>(F.den);
+
+    template <exact_ratio F, typename T1, typename T2>
+    using cross_product_t = std::conditional_t<
+      std::is_same_v<product_int_t<T1, F.den>, std::int64_t> &&
+        std::is_same_v<product_int_t<T2, F.num>, std::int64_t>,
+      std::int64_t,
+      exact_int>;
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Three-way comparison between a value in unit `U_L` and a value in unit `U_R`
+   *
+   * Integral values are compared exactly by cross-multiplying with the conversion factor in
+   * 64-bit arithmetic when that cannot overflow and 128-bit arithmetic otherwise, instead of
+   * truncating one of the sides first.
+   */
+  template <typename U_L, typename U_R, typename T1, typename T2>
+  [[nodiscard]]
+  constexpr auto compare_in_units(const T1& lhs, const T2& rhs) noexcept {
+    constexpr exact_ratio F = conversion_factor_v<U_R, U_L>;
+    if constexpr (detail::cross_multiplies<F, T1, T2>) {
+      using intermediate = detail::cross_product_t<F, T1, T2>;
+      return static_cast<intermediate>(lhs) * static_cast<intermediate>(F.den) <=>
+             static_cast<intermediate>(rhs) * static_cast<intermediate>(F.num);
+    } else {
+      return lhs <=> apply_factor<F>(rhs);
+    }
+  }
+
+  /*! @brief `lhs < rhs` between a value in unit `U_L` and a value in unit `U_R`
+   *
+   * Equivalent to `compare_in_units<U_L, U_R>(lhs, rhs) < 0`, but compiles to a single
+   * comparison whenever no cross-multiplication is needed.
+   */
+  template <typename U_L, typename U_R, typename T1, typename T2>
+  [[nodiscard]]
+  constexpr bool less_in_units(const T1& lhs, const T2& rhs) noexcept {
+    constexpr exact_ratio F = conversion_factor_v<U_R, U_L>;
+    if constexpr (detail::cross_multiplies<F, T1, T2>) {
+      using intermediate = detail::cross_product_t<F, T1, T2>;
+      return static_cast<intermediate>(lhs) * static_cast<intermediate>(F.den) <
+             static_cast<intermediate>(rhs) * static_cast<intermediate>(F.num);
+    } else {
+      return lhs < apply_factor<F>(rhs);
+    }
+  }
+
+  /*! @brief `lhs == rhs` between a value in unit `U_L` and a value in unit `U_R`
+   *
+   * See @ref quantify::less_in_units
+   */
+  template <typename U_L, typename U_R, typename T1, typename T2>
+  [[nodiscard]]
+  constexpr bool equal_in_units(const T1& lhs, const T2& rhs) noexcept {
+    constexpr exact_ratio F = conversion_factor_v<U_R, U_L>;
+    if constexpr (detail::cross_multiplies<F, T1, T2>) {
+      using intermediate = detail::cross_product_t<F, T1, T2>;
+      return static_cast<intermediate>(lhs) * static_cast<intermediate>(F.den) ==
+             static_cast<intermediate>(rhs) * static_cast<intermediate>(F.num);
+    } else {
+      return lhs == apply_factor<F>(rhs);
+    }
+  }
+} // namespace quantify
@@ -0,0 +1,100 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  fixed_string.cppm
+ *  \brief Compile-time strings used for unit symbols
+ *
+ */
+
+export module quantify.core:fixed_string;
+import std;
+
+export namespace quantify {
+  /*! @brief Fixed-size, null-terminated string usable in constant expressions.
+   *
+   * Unit symbols are built out of these at compile-time so that composite symbols such as
+   * `(m)/(s)` never need to be concatenated at run-time.
+   *
+   * @tparam N Number of characters, not counting the null terminator
+   */
+  template <std::size_t N>
+  struct fixed_string {
+    char data[N + 1]{};
+
+    constexpr fixed_string() noexcept = default;
+
+    constexpr fixed_string(const char (&str)[N + 1]) noexcept {
+      for (std::size_t i = 0; i < N; ++i) {
+        data[i] = str[i];
+      }
+    }
+
+    [[nodiscard]]
+    constexpr std::size_t size() const noexcept {
+      return N;
+    }
+
+    [[nodiscard]]
+    constexpr std::string_view view() const noexcept {
+      return {data, N};
+    }
+
+    [[nodiscard]]
+    constexpr const char* c_str() const noexcept {
+      return data;
+    }
+
+    template <std::size_t M>
+    constexpr fixed_string<N + M> operator+(const fixed_string<M>& rhs) const noexcept {
+      fixed_string<N + M> result{};
+      for (std::size_t i = 0; i < N; ++i) {
+        result.data[i] = data[i];
+      }
+      for (std::size_t i = 0; i < M; ++i) {
+        result.data[N + i] = rhs.data[i];
+      }
+      return result;
+    }
+
+    template <std::size_t M>
+    constexpr fixed_string<N + M - 1> operator+(const char (&rhs)[M]) const noexcept {
+      return *this + fixed_string<M - 1>{rhs};
+    }
+
+    template <std::size_t M>
+    friend constexpr fixed_string<N + M - 1>
+    operator+(const char (&lhs)[M], const fixed_string& rhs) noexcept {
+      return fixed_string<M - 1>{lhs} + rhs;
+    }
+
+    template <std::size_t M>
+    constexpr bool operator==(const fixed_string<M>& rhs) const noexcept {
+      return view() == rhs.view();
+    }
+  };
+
+  template <std::size_t N>
+  fixed_string(const char (&)[N]) -> fixed_string<N - 1>;
+
+  /*! @brief Static storage for a symbol built at compile-time.
+   *
+   * `Builder` is a `constexpr` function returning a @ref fixed_string. Its result is evaluated
+   * once, at compile-time, and lives for the whole program so views into it never dangle.
+   *
+   * @tparam Builder Pointer to a nullary `constexpr` function returning a @ref fixed_string
+   */
+  template <auto Builder>
+  inline constexpr auto static_symbol = Builder();
+} // namespace quantify
@@ -0,0 +1,297 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  instrumentation.cppm
+ *  \brief Opt-in counters of the unit conversions performed implicitly by quantity operators
+ *
+ */
+
+module;
+#ifndef QUANTIFY_INSTRUMENT_CONVERSIONS
+#define QUANTIFY_INSTRUMENT_CONVERSIONS 0
+#endif
+export module quantify.core:instrumentation;
+import std;
+import :preface;
+import :factor;
+import :concepts;
+
+export namespace quantify {
+  /*! @brief Whether implicit unit conversions are counted
+   *
+   * Set by building with `QUANTIFY_INSTRUMENT_CONVERSIONS` defined to a non-zero value, which
+   * the CMake option of the same name does. When unset, @ref record_conversion compiles to
+   * nothing and @ref conversion_counts is always empty.
+   */
+  inline constexpr bool conversion_instrumentation_enabled = QUANTIFY_INSTRUMENT_CONVERSIONS != 0;
+
+  /*! @brief Kind of operator that converted a quantity into another unit
+   */
+  enum class conversion_site : std::uint8_t {
+    comparison,          //!< `<=>`, `<` and `==` between different units
+    arithmetic,          //!< `+`, `-`, `*` and `/` between different units of the same scale
+    compound_assignment, //!< `+=` and `-=` from a different unit
+    construction,        //!< Converting constructors, including from `std::chrono::duration`
+    assignment,          //!< Converting assignments
+  };
+
+  constexpr std::string_view to_string(conversion_site site) noexcept {
+    switch (site) {
+      case conversion_site::comparison:
+        return "comparison";
+      case conversion_site::arithmetic:
+        return "arithmetic";
+      case conversion_site::compound_assignment:
+        return "compound_assignment";
+      case conversion_site::construction:
+        return "construction";
+      case conversion_site::assignment:
+        return "assignment";
+    }
+    return "unknown";
+  }
+
+  /*! @brief Number of conversions counted from one unit into another at one kind of operator
+   */
+  struct conversion_count {
+    std::string_view from;
+    std::string_view to;
+    conversion_site  site;
+    std::uint64_t    count;
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    //! Distinct (source, target, site) keys that can be counted, further ones are dropped
+    inline constexpr std::uint32_t max_conversion_keys = 1024;
+    inline constexpr std::uint32_t unregistered_key    = std::numeric_limits<std::uint32_t>::max();
+
+    struct conversion_key {
+      std::string_view           from;
+      std::string_view           to;
+      conversion_site            site;
+      std::atomic<std::uint32_t> slot{unregistered_key};
+      conversion_key*            next = nullptr;
+    };
+
+    template <typename U_FROM, typename U_TO, conversion_site Site>
+    inline constinit conversion_key conversion_key_v{
+      U_FROM::symbol_view(), U_TO::symbol_view(), Site
+    };
+
+    //! Counters of one thread. Only their thread writes them, so increments need no RMW. They
+    //! are never freed, so that the counts of finished threads are still reported.
+    struct thread_conversion_counts {
+      std::array<std::atomic<std::uint64_t>, max_conversion_keys> counts{};
+      thread_conversion_counts*                                   next = nullptr;
+    };
+
+    inline constinit std::atomic<conversion_key*>           conversion_keys{nullptr};
+    inline constinit std::atomic<thread_conversion_counts*> conversion_threads{nullptr};
+    inline constinit std::atomic<std::uint32_t>             next_conversion_slot{0};
+    inline constinit std::atomic<std::uint64_t>             dropped_conversions{0};
+
+    template <typename Node>
+    void push_front(std::atomic<Node*>& head, Node* node) noexcept {
+      node->next = head.load(std::memory_order_relaxed);
+      while (!head.compare_exchange_weak(
+        node->next, node, std::memory_order_release, std::memory_order_relaxed
+      )) { }
+    }
+
+    //! Slot of `key` in the counters, assigned the first time any thread counts it
+    inline std::uint32_t conversion_slot(conversion_key& key) noexcept {
+      std::uint32_t slot = key.slot.load(std::memory_order_acquire);
+      if (slot != unregistered_key) [[likely]] {
+        return slot;
+      }
+      const std::uint32_t claimed = next_conversion_slot.fetch_add(1, std::memory_order_relaxed);
+      if (key.slot.compare_exchange_strong(
+            slot, claimed, std::memory_order_acq_rel, std::memory_order_acquire
+          )) {
+        push_front(conversion_keys, &key);
+        return claimed;
+      }
+      // Another thread registered it first, `claimed` is left unused
+      return slot;
+    }
+
+    //! Counters of the calling thread, allocated on first use. Null if the allocation failed,
+    //! in which case it is retried by the next conversion of that thread.
+    inline thread_conversion_counts* local_conversion_counts() noexcept {
+      thread_local constinit thread_conversion_counts* counts = nullptr;
+      if (counts == nullptr) [[unlikely]] {
+        counts = new (std::nothrow) thread_conversion_counts{};
+        if (counts != nullptr) {
+          push_front(conversion_threads, counts);
+        }
+      }
+      return counts;
+    }
+
+    inline void count_conversion(conversion_key& key) noexcept {
+      const std::uint32_t       slot  = conversion_slot(key);
+      thread_conversion_counts* local = local_conversion_counts();
+      if (slot >= max_conversion_keys || local == nullptr) [[unlikely]] {
+        dropped_conversions.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      auto& counter = local->counts[slot];
+      counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    template <typename U_FROM, typename U_TO>
+    consteval bool is_identity_conversion() {
+      if constexpr (std::is_same_v<U_FROM, U_TO>) {
+        return true;
+      } else if constexpr (SameScale<U_FROM, U_TO>) {
+        return conversion_factor_v<U_FROM, U_TO> == exact_ratio{};
+      } else {
+        return false;
+      }
+    }
+
+    //! Appends `str` padded with spaces to `width` columns, aligned to the right or the left
+    inline void
+    append_padded(std::string& out, std::string_view str, std::size_t width, bool right) {
+      const std::size_t padding = str.size() < width ? width - str.size() : 1;
+      if (right) {
+        out.append(padding, ' ');
+        out += str;
+        out.append(2, ' ');
+      } else {
+        out += str;
+        out.append(padding, ' ');
+      }
+    }
+
+    inline void append_json_string(std::string& out, std::string_view str) {
+      out += '"';
+      for (const char c: str) {
+        if (c == '"' || c == '\\') {
+          out += '\\';
+        }
+        out += c;
+      }
+      out += '"';
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Counts one conversion of a value in unit `U_FROM` into unit `U_TO` at `Site`
+   *
+   * Called by the operators of @ref quantify::quantity that convert implicitly. Conversions by
+   * a factor of one and those evaluated at compile-time are not counted. Counting is lock-free:
+   * each thread increments its own counters, and a (source, target, site) key is registered
+   * with a single compare-and-swap the first time it is seen.
+   *
+   * @tparam U_FROM Unit of the converted value
+   * @tparam U_TO Unit it is converted into
+   * @tparam Site Kind of operator performing the conversion
+   */
+  template <typename U_FROM, typename U_TO, conversion_site Site>
+  constexpr void record_conversion() noexcept {
+    if constexpr (conversion_instrumentation_enabled &&
+                  !detail::is_identity_conversion<U_FROM, U_TO>()) {
+      if !consteval {
+        detail::count_conversion(detail::conversion_key_v<U_FROM, U_TO, Site>);
+      }
+    }
+  }
+
+  /*! @brief Conversions counted so far across all threads, most frequent first
+   *
+   * Can be called while other threads keep converting, in which case their latest increments
+   * may or may not be included.
+   */
+  inline std::vector<conversion_count> conversion_counts() {
+    std::vector<conversion_count> result{};
+    for (auto* key = detail::conversion_keys.load(std::memory_order_acquire); key != nullptr;
+         key       = key->next) {
+      const std::uint32_t slot = key->slot.load(std::memory_order_relaxed);
+      if (slot >= detail::max_conversion_keys) {
+        continue;
+      }
+      std::uint64_t total = 0;
+      for (auto* thread = detail::conversion_threads.load(std::memory_order_acquire);
+           thread != nullptr; thread = thread->next) {
+        total += thread->counts[slot].load(std::memory_order_relaxed);
+      }
+      if (total != 0) {
+        result.push_back({key->from, key->to, key->site, total});
+      }
+    }
+    std::ranges::stable_sort(result, std::ranges::greater{}, &conversion_count::count);
+    return result;
+  }
+
+  //! Conversions not counted because more than `1024` distinct keys were seen, or because the
+  //! counters of their thread could not be allocated
+  inline std::uint64_t dropped_conversion_count() noexcept {
+    return detail::dropped_conversions.load(std::memory_order_relaxed);
+  }
+
+  /*! @brief Sets all counters back to zero
+   *
+   * Must not race with conversions in other threads, whose increments could otherwise undo it.
+   */
+  inline void reset_conversion_counts() noexcept {
+    for (auto* thread = detail::conversion_threads.load(std::memory_order_acquire);
+         thread != nullptr; thread = thread->next) {
+      for (auto& counter: thread->counts) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+    detail::dropped_conversions.store(0, std::memory_order_relaxed);
+  }
+
+  //! @ref conversion_counts as a plain-text table, one conversion per row
+  inline std::string conversion_table() {
+    std::string out{};
+    const auto  row = [&](std::string_view count, std::string_view site, std::string_view from,
+                         std::string_view to) {
+      detail::append_padded(out, count, 14, true);
+      detail::append_padded(out, site, 21, false);
+      detail::append_padded(out, from, 22, false);
+      out += to;
+      out += '\n';
+    };
+    row("count", "site", "from", "to");
+    for (const auto& [from, to, site, count]: conversion_counts()) {
+      row(std::to_string(count), to_string(site), from, to);
+    }
+    return out;
+  }
+
+  //! @ref conversion_counts as a JSON array of `{"from", "to", "site", "count"}` objects
+  inline std::string conversion_json() {
+    std::string out   = "[";
+    bool        first = true;
+    for (const auto& [from, to, site, count]: conversion_counts()) {
+      out += first ? "\n  {\"from\": " : ",\n  {\"from\": ";
+      detail::append_json_string(out, from);
+      out += ", \"to\": ";
+      detail::append_json_string(out, to);
+      out += ", \"site\": ";
+      detail::append_json_string(out, to_string(site));
+      out += ", \"count\": ";
+      out += std::to_string(count);
+      out += '}';
+      first = false;
+    }
+    out += first ? "]" : "\n]";
+    return out;
+  }
+} // namespace quantify
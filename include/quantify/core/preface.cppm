@@ -20,6 +20,7 @@ export module quantify.core:preface;
 import std;
 import packtl;
 export import :ratio;
+export import :fixed_string;
 
 namespace quantify {
   export struct no_scale {};
@@ -101,73 +102,5 @@ namespace quantify {
     //! See @refitem has_scale
     template <typename S>
     constexpr bool has_scale_v = has_scale<S>;
-
-    //! @cond NEVER
-    template <typename Mul, typename CancelProduct>
-    using cancel_out = typename packtl::take_one_out<CancelProduct, Mul>::type;
-
-    template <typename...>
-    struct cancel_out_many {};
-
-    template <typename Mul, typename CP>
-    struct cancel_out_many<Mul, CP> {
-      using type = cancel_out<Mul, CP>;
-    };
-
-    template <typename Mul, typename CP1, typename... CancelProducts>
-    struct cancel_out_many<Mul, CP1, CancelProducts...> {
-    private:
-      using cancelled      = typename packtl::take_one_out<CP1, Mul>::type;
-      using cancelled_many = std::conditional_t<
-        (sizeof...(CancelProducts) > 1),
-        cancel_out_many<cancelled, CancelProducts...>,
-        packtl::take_one_out<typename packtl::get_first<CancelProducts...>::type, cancelled>>;
-
-      using result = std::
-        conditional_t<sizeof...(CancelProducts) == 0, cancelled, typename cancelled_many::type>;
-
-    public:
-      using type = result;
-    };
-
-    template <typename Mul, template <typename...> typename Pack, typename... CancelProducts>
-    struct cancel_out_many<Mul, Pack<CancelProducts...>> {
-      using type = typename cancel_out_many<Mul, CancelProducts...>::type;
-    };
-
-    template <typename M>
-    struct normalize {
-      using type = M;
-    };
-
-    template <typename M>
-    using normalize_t = typename normalize<M>::type;
-
-
-    template <typename M, typename...>
-    struct normalize_impl {
-      using type = M;
-    };
-
-    template <typename M>
-    using normalize_impl_t = typename normalize_impl<M>::type;
-
-    template <typename Num, typename Den, typename... Ps>
-    struct normalize_impl<mul<frac<Num, Den>, Ps...>> {
-      using type = frac<normalize_t<mul<Ps..., Num>>, Den>;
-    };
-
-    template <typename P1, typename... Ps>
-      requires(!is_frac_v<P1> && (is_frac_v<Ps> || ...))
-    struct normalize_impl<mul<P1, Ps...>> {
-      using type = normalize_impl_t<mul<Ps..., P1>>;
-    };
-
-
-    template <typename... Ps>
-    struct normalize<mul<Ps...>> {
-      using type = normalize_impl_t<typename packtl::flatten<mul<Ps...>>::type>;
-    };
-    //! @endcond
   }
 } // namespace quantify
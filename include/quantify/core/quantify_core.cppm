@@ -26,5 +26,11 @@ export import std;
 
 export import :preface;
 export import :concepts;
+export import :factor;
+export import :affine;
+export import :canonical;
 export import :reduce_rules;
+export import :unit_list;
+export import :chrono;
+export import :instrumentation;
 export import :quantity;
@@ -22,6 +22,10 @@ export module quantify.core:quantity;
 import std;
 import :preface;
 import :concepts;
+import :factor;
+import :affine;
+import :chrono;
+import :instrumentation;
 export import :frac;
 export import :mul;
 
@@ -33,120 +37,202 @@ export namespace quantify {
 
     T value { };
 
-    T value_as_base_unit() const {
-      return value * U::template factor<T>::numerator / U::template factor<T>::denominator;
+    constexpr T value_as_base_unit() const noexcept {
+      return apply_factor<unit_factor_v<U>>(value);
     }
 
     template<typename U1>
       requires SameScale<U, U1>
-    auto operator<=>(const quantity<U1, T>& rhl) const {
-      return this->value <=> rhl.template as<U>().value;
+    constexpr auto operator<=>(const quantity<U1, T>& rhl) const noexcept {
+      record_conversion<U1, U, conversion_site::comparison>();
+      return compare_in_units<U, U1>(this->value, rhl.value);
     }
 
     template<typename U1>
       requires SameScale<U, U1>
-    bool operator<(const quantity<U1, T>& rhl) const {
-      return this->value < rhl.template as<U>().value;
+    constexpr bool operator<(const quantity<U1, T>& rhl) const noexcept {
+      record_conversion<U1, U, conversion_site::comparison>();
+      return less_in_units<U, U1>(this->value, rhl.value);
     }
 
     template<typename U1>
       requires SameScale<U, U1>
-    bool operator==(const quantity<U1, T>& rhl) const {
-      return this->value == rhl.template as<U>().value;
+    constexpr bool operator==(const quantity<U1, T>& rhl) const noexcept {
+      record_conversion<U1, U, conversion_site::comparison>();
+      return equal_in_units<U, U1>(this->value, rhl.value);
     }
 
     template<typename T1>
-      requires (not QuantityConcept<T1>)
-    auto operator<=>(const T1& rhl) const {
+      requires ScalarOperand<T1>
+    constexpr auto operator<=>(const T1& rhl) const noexcept {
       return this->value <=> rhl;
     }
 
     template<typename T1>
-      requires (not QuantityConcept<T1>)
-    bool operator<(const T1& rhl) const {
+      requires ScalarOperand<T1>
+    constexpr bool operator<(const T1& rhl) const noexcept {
       return this->value < rhl;
     }
 
     template<typename T1>
-      requires (not QuantityConcept<T1>)
-    bool operator==(const T1& rhl) const {
+      requires ScalarOperand<T1>
+    constexpr bool operator==(const T1& rhl) const noexcept {
       return this->value == rhl;
     }
 
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr auto operator<=>(const std::chrono::duration<Rep, Period>& rhl) const noexcept {
+      return *this <=> quantity<duration_unit_t<Period>, T>{rhl};
+    }
+
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr bool operator<(const std::chrono::duration<Rep, Period>& rhl) const noexcept {
+      return *this < quantity<duration_unit_t<Period>, T>{rhl};
+    }
+
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr bool operator==(const std::chrono::duration<Rep, Period>& rhl) const noexcept {
+      return *this == quantity<duration_unit_t<Period>, T>{rhl};
+    }
+
     template<typename U1>
       requires SameScale<U, U1>
-    quantity<R(frac<R(U), R(U)>), T> operator/(const quantity<U1, T> &rhl) const {
-      return {this->value / rhl.template as<R(U)>().value};
+    constexpr quantity<R(frac<R(U), R(U)>), T> operator/(const quantity<U1, T> &rhl) const noexcept {
+      record_conversion<U1, R(U), conversion_site::arithmetic>();
+      return {this->value / apply_factor<conversion_factor_v<U1, R(U)>>(rhl.value)};
     }
 
     template<typename U1>
       requires (!SameScale<U, U1>)
-    quantity<R(frac<R(U), R(U1)>), T> operator/(const quantity<U1, T> &rhl) const {
+    constexpr quantity<R(frac<R(U), R(U1)>), T> operator/(const quantity<U1, T> &rhl) const noexcept {
       return {this->value / rhl.value};
     }
 
     template<typename T1>
-      requires (not QuantityConcept<T1>)
-    quantity<R(U), T> operator/(const T1& rhl) const {
+      requires ScalarOperand<T1>
+    constexpr quantity<R(U), T> operator/(const T1& rhl) const noexcept {
       return {this->value / rhl};
     }
 
+    //! Divides by a `std::chrono::duration` as a quantity of its unit, e.g. [m] / [ns] = [m/ns]
+    template<typename Rep, ChronoPeriod Period>
+    friend constexpr auto
+    operator/(const quantity& lhs, const std::chrono::duration<Rep, Period>& rhs) noexcept {
+      return lhs / quantity<duration_unit_t<Period>, T>{rhs};
+    }
+
     template<typename U1>
       requires SameScale<U, U1>
-    quantity<R(mul<R(U), R(U)>), T> operator*(const quantity<U1, T> &rhl) const {
-      return {this->value * rhl.template as<R(U)>().value};
+    constexpr quantity<R(mul<R(U), R(U)>), T> operator*(const quantity<U1, T> &rhl) const noexcept {
+      record_conversion<U1, R(U), conversion_site::arithmetic>();
+      return {this->value * apply_factor<conversion_factor_v<U1, R(U)>>(rhl.value)};
     }
 
     template<typename U1>
       requires (!SameScale<U, U1>)
-    quantity<R(mul<R(U), R(U1)>), T> operator*(const quantity<U1, T> &rhl) const {
+    constexpr quantity<R(mul<R(U), R(U1)>), T> operator*(const quantity<U1, T> &rhl) const noexcept {
       return {this->value * rhl.value};
     }
 
     template<typename T1>
-      requires (not QuantityConcept<T1>)
-    quantity<R(U), T> operator*(const T1& rhl) const {
+      requires ScalarOperand<T1>
+    constexpr quantity<R(U), T> operator*(const T1& rhl) const noexcept {
       return {this->value * rhl};
     }
 
+    //! Multiplies by a `std::chrono::duration` as a quantity of its unit. A friend, rather than a
+    //! member, so that it is more specialized than `std::chrono::operator*(const Rep&, duration)`
+    template<typename Rep, ChronoPeriod Period>
+    friend constexpr auto
+    operator*(const quantity& lhs, const std::chrono::duration<Rep, Period>& rhs) noexcept {
+      return lhs * quantity<duration_unit_t<Period>, T>{rhs};
+    }
+
     template<typename U1, typename T1>
       requires (SameScale<U, U1>)
-    quantity<R(U), T1> operator+(const quantity<U1, T1> &rhl) const {
-      return {this->value + rhl.template as<R(U)>().value};
+    constexpr quantity<R(U), T1> operator+(const quantity<U1, T1> &rhl) const noexcept {
+      record_conversion<U1, R(U), conversion_site::arithmetic>();
+      return {this->value + apply_factor<conversion_factor_v<U1, R(U)>>(rhl.value)};
     }
 
     template<typename U1, typename T1>
       requires (SameScale<U, U1>)
-    quantity<R(U), T1>& operator+=(const quantity<U1, T1> &rhl) {
-      this->value += rhl.template as<R(U)>().value;
+    constexpr quantity& operator+=(const quantity<U1, T1> &rhl) noexcept {
+      record_conversion<U1, R(U), conversion_site::compound_assignment>();
+      this->value += apply_factor<conversion_factor_v<U1, R(U)>>(rhl.value);
       return *this;
     }
 
     template<typename U1, typename T1>
       requires (SameScale<U, U1>)
-    quantity<R(U), T1> operator-(const quantity<U1, T1> &rhl) const {
-      return {this->value - rhl.template as<R(U)>().value};
+    constexpr quantity<R(U), T1> operator-(const quantity<U1, T1> &rhl) const noexcept {
+      record_conversion<U1, R(U), conversion_site::arithmetic>();
+      return {this->value - apply_factor<conversion_factor_v<U1, R(U)>>(rhl.value)};
     }
 
     template<typename U1, typename T1>
       requires (SameScale<U, U1>)
-    quantity<R(U), T1>& operator-=(const quantity<U1, T1> &rhl) {
-      this->value -= rhl.template as<R(U)>().value;
+    constexpr quantity& operator-=(const quantity<U1, T1> &rhl) noexcept {
+      record_conversion<U1, R(U), conversion_site::compound_assignment>();
+      this->value -= apply_factor<conversion_factor_v<U1, R(U)>>(rhl.value);
       return *this;
     }
 
-    quantity<U, T> operator-() const {
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr quantity<R(U), T> operator+(const std::chrono::duration<Rep, Period>& rhl) const noexcept {
+      return *this + quantity<duration_unit_t<Period>, T>{rhl};
+    }
+
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr quantity<R(U), T> operator-(const std::chrono::duration<Rep, Period>& rhl) const noexcept {
+      return *this - quantity<duration_unit_t<Period>, T>{rhl};
+    }
+
+    constexpr quantity<U, T> operator-() const noexcept {
       return {-(this->value)};
     }
 
     constexpr quantity() = default;
 
-    constexpr quantity(T value_): value(value_) {
+    constexpr quantity(T value_) noexcept: value(value_) {
+    }
+
+    /*! @brief From a `std::chrono::duration` of the same scale
+     *
+     * The factor between the period and `U` is folded at compile-time, so ticks are copied as
+     * they are when both match. Like between durations, the conversion is only implicit when it
+     * cannot lose precision.
+     */
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr explicit(
+      !detail::lossless_duration_conversion<Rep, T, conversion_factor_v<duration_unit_t<Period>, U>>
+    ) quantity(const std::chrono::duration<Rep, Period>& duration) noexcept
+        : value(detail::convert_ticks<conversion_factor_v<duration_unit_t<Period>, U>, T>(
+            duration.count()
+          )) {
+      record_conversion<duration_unit_t<Period>, U, conversion_site::construction>();
+    }
+
+    //! Into a `std::chrono::duration` of the same scale, see the constructor from durations
+    template<typename Rep, ChronoPeriod Period>
+      requires SameScale<U, duration_unit_t<Period>>
+    constexpr explicit(
+      !detail::lossless_duration_conversion<T, Rep, conversion_factor_v<U, duration_unit_t<Period>>>
+    ) operator std::chrono::duration<Rep, Period>() const noexcept {
+      return std::chrono::duration<Rep, Period>{
+        detail::convert_ticks<conversion_factor_v<U, duration_unit_t<Period>>, Rep>(value)
+      };
     }
 
     //! Copy
     template <typename T1>
-    quantity(const quantity<U,T1> &other) {
+    constexpr quantity(const quantity<U,T1> &other) noexcept {
       this->value = other.value;
     }
 
@@ -157,13 +243,14 @@ export namespace quantify {
         (SameScale<U, U1> || Convertible<U, U1, T> ||
          ConvertibleScales<typename U::scale, typename U1::scale, U, U1, T>)
       )
-    quantity(const quantity<U1, T1>& other) {
+    constexpr quantity(const quantity<U1, T1>& other) noexcept {
+      record_conversion<U1, U, conversion_site::construction>();
       this->value = other.template as<U>().value;
     }
 
     //! Copy
     template <typename T1>
-    quantity &operator=(const quantity<U,T1> &rhl) {
+    constexpr quantity &operator=(const quantity<U,T1> &rhl) noexcept {
       this->value = rhl.value;
       return *this;
     }
@@ -175,14 +262,15 @@ export namespace quantify {
         (SameScale<U, U1> || Convertible<U, U1, T> ||
          ConvertibleScales<typename U::scale, typename U1::scale, U, U1, T>)
       )
-    quantity &operator=(const quantity<U1, T1> &rhl) {
+    constexpr quantity &operator=(const quantity<U1, T1> &rhl) noexcept {
+      record_conversion<U1, U, conversion_site::assignment>();
       this->value = rhl.template as<U>().value;
       return *this;
     }
 
     //! Move
     template <typename T1>
-    quantity(quantity<U,T1> &&other) noexcept {
+    constexpr quantity(quantity<U,T1> &&other) noexcept {
       this->value = other.value;
     }
 
@@ -193,13 +281,14 @@ export namespace quantify {
         (SameScale<U, U1> || Convertible<U, U1, T> ||
          ConvertibleScales<typename U::scale, typename U1::scale, U, U1, T>)
       )
-    quantity(quantity<U1, T1>&& other) {
+    constexpr quantity(quantity<U1, T1>&& other) noexcept {
+      record_conversion<U1, U, conversion_site::construction>();
       this->value = other.template as<U>().value;
     }
 
     //! Move
     template <typename T1>
-    quantity &operator=(quantity<U,T1> &&rhl) noexcept {
+    constexpr quantity &operator=(quantity<U,T1> &&rhl) noexcept {
       this->value = rhl.value;
       return *this;
     }
@@ -211,7 +300,8 @@ export namespace quantify {
         (SameScale<U, U1> || Convertible<U, U1, T> ||
          ConvertibleScales<typename U::scale, typename U1::scale, U, U1, T>)
       )
-    quantity &operator=(quantity<U1, T1> &&rhl) {
+    constexpr quantity &operator=(quantity<U1, T1> &&rhl) noexcept {
+      record_conversion<U1, U, conversion_site::assignment>();
       this->value = rhl.template as<U>().value;
       return *this;
     }
@@ -220,21 +310,17 @@ export namespace quantify {
     template<typename U1>
       requires SameScale<U, U1> || Convertible<U, U1, T> || ConvertibleScales<typename U::scale, typename U1::scale, U, U1, T>
     [[nodiscard]]
-    constexpr quantity<U1, T> as() const {
+    constexpr quantity<U1, T> as() const noexcept {
       if constexpr (std::is_same_v<U, U1>) {
         return *this;
       } else if constexpr (SameScale<U, U1>) {
-        return quantity<U1, T> {
-          this->value
-          * (U1::template factor<T>::denominator
-             * U::template factor<T>::numerator)
-          / (U1::template factor<T>::numerator
-             * U::template factor<T>::denominator)
-        };
+        return quantity<U1, T> {apply_factor<conversion_factor_v<U, U1>>(this->value)};
       // } else if constexpr (requires { scale_conversion_t<typename U::scale, typename U1::scale>::template forward<U, U1, T>(*this); }) {
       //   return scale_conversion_t<typename U::scale, typename U1::scale>::template forward<U, U1, T>(*this);
       // } else if constexpr (requires { scale_conversion_t<typename U1::scale, typename U::scale>::template backward<U, U1, T>(*this); }) {
       //   return scale_conversion_t<typename U1::scale, typename U::scale>::template backward<U, U1, T>(*this);
+      } else if constexpr (AffineScales<typename U::scale, typename U1::scale>) {
+        return quantity<U1, T> {affine_conversion<U, U1>::apply(this->value)};
       } else if constexpr (requires { scale_conversion_t<typename U::scale, typename U1::scale>{}; }) {
         return scale_conversion_t<typename U::scale, typename U1::scale>::template forward<U, U1, T>(*this);
       } else if constexpr (requires { scale_conversion_t<typename U1::scale, typename U::scale>{}; }) {
@@ -254,7 +340,7 @@ export namespace quantify {
       std::string str { };
       str.append(std::to_string(value));
       str.append(" [");
-      str.append(U::symbol());
+      str.append(U::symbol_view());
       str.append(":");
       str.append(typeid(T).name());
       str.append("]");
@@ -263,23 +349,81 @@ export namespace quantify {
   };
 
   template <QuantityConcept Q, typename T1>
-    requires(not QuantityConcept<T1>)
-  Q operator/(const T1& lhs, const Q& rhs) {
-    return {lhs / rhs->value};
+    requires ScalarOperand<T1>
+  constexpr quantity<reduce<frac<no_unit, reduce<typename Q::unit>>>, typename Q::data_type>
+  operator/(const T1& lhs, const Q& rhs) noexcept {
+    return {lhs / rhs.value};
   }
 
   template <QuantityConcept Q, typename T1>
-    requires(not QuantityConcept<T1>)
-  Q operator*(const T1& lhs, const Q& rhs) {
+    requires ScalarOperand<T1>
+  constexpr Q operator*(const T1& lhs, const Q& rhs) noexcept {
+    return rhs * lhs;
+  }
+
+  template <typename Rep, ChronoPeriod Period, QuantityConcept Q>
+  constexpr auto operator*(const std::chrono::duration<Rep, Period>& lhs, const Q& rhs) noexcept {
     return rhs * lhs;
   }
 
+  //! A `std::chrono::duration` deduces a quantity of the unit of its period, e.g. `std::milli`
+  //! deduces `time::milliseconds`
+  template <typename Rep, ChronoPeriod Period>
+  quantity(std::chrono::duration<Rep, Period>) -> quantity<duration_unit_t<Period>, Rep>;
+
   template<typename U, typename T>
   using Q = quantity<U, T>;
+
+  //! @cond NEVER
+  namespace detail {
+    //! Value of unit `U_R` converted the way the operators of `quantity<U_L, T>` convert it
+    template <typename U_L, typename U_R, typename T>
+    constexpr T converted_operand(const T& value) noexcept {
+      if constexpr (SameScale<U_L, U_R>) {
+        return apply_factor<conversion_factor_v<U_R, reduce<U_L>>>(value);
+      } else {
+        return value;
+      }
+    }
+
+    //! Unit of the product of quantities in `U_L` and `U_R`
+    template <typename U_L, typename U_R, typename T>
+    using product_unit_t =
+      typename decltype(std::declval<quantity<U_L, T>>() * std::declval<quantity<U_R, T>>())::unit;
+
+    //! Unit of the quotient of quantities in `U_L` and `U_R`
+    template <typename U_L, typename U_R, typename T>
+    using quotient_unit_t =
+      typename decltype(std::declval<quantity<U_L, T>>() / std::declval<quantity<U_R, T>>())::unit;
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Predicate that checks if a quantity is a zero-cost wrapper around its data type
+   *
+   * Such quantities have the same size and alignment as `T` and are trivially copyable whenever
+   * `T` is, so the compiler is free to keep them in registers and vectorize them like raw values.
+   *
+   * @tparam U Unit
+   * @tparam T Underlying data type
+   */
+  template <typename U, typename T>
+  constexpr bool is_layout_transparent_v =
+    sizeof(quantity<U, T>) == sizeof(T) && alignof(quantity<U, T>) == alignof(T) &&
+    std::is_standard_layout_v<quantity<U, T>> == std::is_standard_layout_v<T> &&
+    std::is_trivially_copyable_v<quantity<U, T>> == std::is_trivially_copyable_v<T>;
+
+  static_assert(is_layout_transparent_v<no_unit, float>);
+  static_assert(is_layout_transparent_v<no_unit, double>);
+  static_assert(is_layout_transparent_v<no_unit, long double>);
+  static_assert(is_layout_transparent_v<no_unit, std::int8_t>);
+  static_assert(is_layout_transparent_v<no_unit, std::int16_t>);
+  static_assert(is_layout_transparent_v<no_unit, std::int32_t>);
+  static_assert(is_layout_transparent_v<no_unit, std::int64_t>);
+  static_assert(is_layout_transparent_v<no_unit, std::uint64_t>);
 }
 
 export template<typename U, typename T>
 std::ostream &operator<<(std::ostream &o, const quantify::quantity<U, T> &quantity) {
   o << quantity.to_string();
   return o;
-}
\ No newline at end of file
+}
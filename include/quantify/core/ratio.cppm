@@ -14,6 +14,7 @@
 // limitations under the License.
 
 export module quantify.core:ratio;
+import std;
 
 export
 namespace quantify {
@@ -28,4 +29,159 @@ namespace quantify {
     static constexpr T numerator   = Num;
     static constexpr T denominator = Den;
   };
+
+  //! Integer type used for exact compile-time arithmetic on conversion factors
+  using exact_int = __int128;
+
+  /*! @brief Exact rational number used to fold conversion factors at compile-time.
+   *
+   * Values are always kept reduced with a positive denominator. Operations that do not fit in
+   * @ref quantify::exact_int set the `overflow` flag instead of wrapping around, so that callers
+   * can reject them with a `static_assert`.
+   */
+  struct exact_ratio {
+    exact_int num      = 1;
+    exact_int den      = 1;
+    bool      overflow = false;
+
+    static constexpr exact_int abs(exact_int x) noexcept {
+      return x < 0 ? -x : x;
+    }
+
+    static constexpr exact_int gcd(exact_int a, exact_int b) noexcept {
+      a = abs(a);
+      b = abs(b);
+      while (b != 0) {
+        const exact_int t = a % b;
+        a                 = b;
+        b                 = t;
+      }
+      return a;
+    }
+
+    [[nodiscard]]
+    constexpr exact_ratio reduced() const noexcept {
+      if (den == 0) {
+        return {num, den, true};
+      }
+      const exact_int g    = gcd(num, den);
+      const exact_int sign = den < 0 ? -1 : 1;
+      return {sign * num / (g == 0 ? 1 : g), sign * den / (g == 0 ? 1 : g), overflow};
+    }
+
+    [[nodiscard]]
+    constexpr exact_ratio inverse() const noexcept {
+      return exact_ratio{den, num, overflow}.reduced();
+    }
+
+    [[nodiscard]]
+    constexpr bool is_integer() const noexcept {
+      return den == 1;
+    }
+
+    /*! @brief Value of the ratio in type `T`
+     *
+     * Floating point values are correctly rounded: the quotient is computed exactly by long
+     * division and rounded once, to nearest with ties to even, unless it is subnormal in `T`.
+     * Other types get the quotient in `long double`, which is off by at most three roundings.
+     */
+    template <typename T>
+    [[nodiscard]]
+    constexpr T as() const noexcept {
+      if constexpr (std::is_floating_point_v<T>) {
+        return rounded<T>();
+      } else {
+        return static_cast<T>(static_cast<long double>(num) / static_cast<long double>(den));
+      }
+    }
+
+  private:
+    static constexpr int bit_width(unsigned __int128 x) noexcept {
+      const auto high = static_cast<std::uint64_t>(x >> 64);
+      return high != 0 ? 64 + std::bit_width(high) : std::bit_width(static_cast<std::uint64_t>(x));
+    }
+
+    template <typename T>
+    constexpr T rounded() const noexcept {
+      using wide = unsigned __int128;
+      if (num == 0) {
+        return T{0};
+      }
+      // Significand bits of `T`, plus one guard bit for rounding
+      constexpr int bits = std::numeric_limits<T>::digits + 1;
+      const wide    d    = static_cast<wide>(abs(den));
+      wide          m    = static_cast<wide>(abs(num)) / d;
+      wide          r    = static_cast<wide>(abs(num)) % d;
+      int           e    = 0;
+      while (bit_width(m) < bits) {
+        r <<= 1;
+        m = m << 1 | (r >= d);
+        r -= (r >= d) * d;
+        --e;
+      }
+      bool sticky = r != 0;
+      while (bit_width(m) > bits) {
+        sticky = sticky || (m & 1) != 0;
+        m >>= 1;
+        ++e;
+      }
+      const bool guard = (m & 1) != 0;
+      m >>= 1;
+      ++e;
+      if (guard && (sticky || (m & 1) != 0)) {
+        ++m;
+      }
+      T result = static_cast<T>(m);
+      for (; e > 0; --e) {
+        result *= T{2};
+      }
+      for (; e < 0; ++e) {
+        result /= T{2};
+      }
+      return num < 0 ? -result : result;
+    }
+
+  public:
+
+    friend constexpr exact_ratio operator*(const exact_ratio& lhs, const exact_ratio& rhs) noexcept {
+      // Cross-reduce first so that intermediate products stay as small as possible
+      const exact_int g1 = gcd(lhs.num, rhs.den);
+      const exact_int g2 = gcd(rhs.num, lhs.den);
+      exact_ratio     result{1, 1, lhs.overflow || rhs.overflow};
+      result.overflow |= __builtin_mul_overflow(
+        lhs.num / (g1 == 0 ? 1 : g1), rhs.num / (g2 == 0 ? 1 : g2), &result.num
+      );
+      result.overflow |= __builtin_mul_overflow(
+        lhs.den / (g2 == 0 ? 1 : g2), rhs.den / (g1 == 0 ? 1 : g1), &result.den
+      );
+      return result.reduced();
+    }
+
+    friend constexpr exact_ratio operator/(const exact_ratio& lhs, const exact_ratio& rhs) noexcept {
+      return lhs * rhs.inverse();
+    }
+
+    friend constexpr exact_ratio operator+(const exact_ratio& lhs, const exact_ratio& rhs) noexcept {
+      const exact_int g        = gcd(lhs.den, rhs.den);
+      bool            overflow = lhs.overflow || rhs.overflow;
+      exact_int       l{}, r{}, d{};
+      overflow |= __builtin_mul_overflow(lhs.num, rhs.den / g, &l);
+      overflow |= __builtin_mul_overflow(rhs.num, lhs.den / g, &r);
+      overflow |= __builtin_mul_overflow(lhs.den / g, rhs.den, &d);
+      overflow |= __builtin_add_overflow(l, r, &l);
+      return exact_ratio{l, d, overflow}.reduced();
+    }
+
+    friend constexpr exact_ratio operator-(const exact_ratio& rhs) noexcept {
+      return {-rhs.num, rhs.den, rhs.overflow};
+    }
+
+    friend constexpr exact_ratio operator-(const exact_ratio& lhs, const exact_ratio& rhs) noexcept {
+      return lhs + (-rhs);
+    }
+
+    friend constexpr bool operator==(const exact_ratio& lhs, const exact_ratio& rhs) noexcept {
+      return lhs.num == rhs.num && lhs.den == rhs.den;
+    }
+  };
 }
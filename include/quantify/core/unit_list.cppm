@@ -0,0 +1,74 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  unit_list.cppm
+ *  \brief Lists of units, used to catalogue the units of each scale
+ *
+ */
+
+export module quantify.core:unit_list;
+import std;
+import :canonical;
+
+export namespace quantify {
+  /*! @brief Compile-time list of units
+   *
+   * Every built-in scale lists its units in a `units` alias, see `SCALE_UNITS`.
+   *
+   * @tparam Units Units in the list
+   */
+  template <typename... Units>
+  struct unit_list {
+    static constexpr std::size_t size = sizeof...(Units);
+
+    //! Calls `f.template operator()<U>()` for every unit `U` in the list, in order
+    template <typename F>
+    static constexpr void for_each(F&& f) {
+      (f.template operator()<Units>(), ...);
+    }
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    template <typename U>
+    struct unit_list_items {
+      using type = type_list<U>;
+    };
+
+    template <typename... Units>
+    struct unit_list_items<unit_list<Units...>> {
+      using type = type_list<Units...>;
+    };
+
+    template <typename List>
+    struct to_unit_list;
+
+    template <typename... Units>
+    struct to_unit_list<type_list<Units...>> {
+      using type = unit_list<Units...>;
+    };
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Concatenates units and unit lists into a single, flat @ref quantify::unit_list
+   *
+   * ```c++
+   * unit_list_t<metric_meter, inches, feet> // unit_list<nanometer, ..., megameter, inches, feet>
+   * ```
+   */
+  template <typename... UnitsOrLists>
+  using unit_list_t = typename detail::to_unit_list<
+    detail::concat_t<typename detail::unit_list_items<UnitsOrLists>::type...>>::type;
+} // namespace quantify
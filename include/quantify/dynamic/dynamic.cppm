@@ -0,0 +1,338 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  dynamic.cppm
+ *  \brief Quantities whose unit is only known at run-time
+ *
+ * A @ref quantify::dynamic_quantity carries its dimension and its conversion factor next to its
+ * value. The dimension packs the exponent of every base scale into a single 64-bit word, one
+ * signed byte per base scale, so that checking dimensions is a single integer comparison and
+ * multiplying or dividing quantities adds or subtracts all exponents at once.
+ *
+ * Operations that mix incompatible dimensions do not branch into an error path: they yield an
+ * invalid quantity instead, which stays invalid through any further arithmetic, much like a NaN.
+ * Validity is checked once, when converting back into a static @ref quantify::quantity.
+ */
+
+export module quantify.dynamic;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  /*! @brief Assigns a lane of @ref quantify::dimension to a base scale
+   *
+   * Specialized for every base scale with a `static constexpr unsigned lane` member, see
+   * `BASE_DIMENSION`. Units whose scale is not made of base scales with a lane cannot be used
+   * with @ref quantify::dynamic_quantity.
+   *
+   * @tparam Scale Base scale
+   */
+  template <typename Scale>
+  struct base_dimension {};
+
+  /*! @brief Exponents of the base scales, packed in a 64-bit word
+   *
+   * Each of the 8 lanes holds the exponent of one base scale as a signed byte. Multiplication
+   * and division add and subtract all lanes at once without carrying from one lane into the
+   * next. Exponents wrap around outside of [-128, 127].
+   */
+  struct dimension {
+    static constexpr unsigned      lanes     = 8;
+    static constexpr unsigned      lane_bits = 8;
+    static constexpr std::uint64_t high_bits = 0x8080808080808080;
+
+    std::uint64_t bits = 0;
+
+    //! Dimension with `exponent` in lane `lane` and zero everywhere else
+    static constexpr dimension basis(unsigned lane, int exponent) noexcept {
+      const auto byte = static_cast<std::uint64_t>(static_cast<std::uint8_t>(exponent));
+      return {byte << (lane * lane_bits)};
+    }
+
+    [[nodiscard]]
+    constexpr int exponent(unsigned lane) const noexcept {
+      return static_cast<std::int8_t>(bits >> (lane * lane_bits));
+    }
+
+    [[nodiscard]]
+    constexpr bool dimensionless() const noexcept {
+      return bits == 0;
+    }
+
+    friend constexpr dimension operator*(dimension lhs, dimension rhs) noexcept {
+      const std::uint64_t low = (lhs.bits & ~high_bits) + (rhs.bits & ~high_bits);
+      return {low ^ ((lhs.bits ^ rhs.bits) & high_bits)};
+    }
+
+    friend constexpr dimension operator/(dimension lhs, dimension rhs) noexcept {
+      const std::uint64_t low = (lhs.bits | high_bits) - (rhs.bits & ~high_bits);
+      return {low ^ ((lhs.bits ^ ~rhs.bits) & high_bits)};
+    }
+
+    friend constexpr bool operator==(dimension lhs, dimension rhs) noexcept = default;
+  };
+
+  /*! @brief Run-time conversion factor of a @ref quantify::dynamic_quantity
+   *
+   * The same factor as @ref quantify::unit_factor_v, not necessarily reduced. A zero numerator
+   * or denominator marks an invalid quantity.
+   */
+  struct dynamic_factor {
+    std::int64_t num = 1;
+    std::int64_t den = 1;
+
+    [[nodiscard]]
+    constexpr bool valid() const noexcept {
+      return num != 0 && den != 0;
+    }
+
+    [[nodiscard]]
+    constexpr dynamic_factor inverse() const noexcept {
+      return {den, num};
+    }
+
+    friend constexpr bool operator==(dynamic_factor lhs, dynamic_factor rhs) noexcept = default;
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    template <typename Terms>
+    struct terms_dimension;
+
+    template <typename... Terms>
+    struct terms_dimension<type_list<Terms...>> {
+      static constexpr bool known =
+        (requires { base_dimension<typename Terms::leaf>::lane; } && ...);
+
+      static constexpr dimension value() noexcept {
+        return (dimension{} * ... *
+                dimension::basis(base_dimension<typename Terms::leaf>::lane, Terms::exponent));
+      }
+    };
+
+    //! Multiplies `value` by `from / to`. The ratio is computed in 64 bits when it fits, which
+    //! is the case for any two catalogued units, and in 128 bits otherwise. Invalid factors
+    //! yield a zero value instead of dividing by zero; the callers mark the result invalid.
+    template <typename T>
+    constexpr T rescale(const T& value, dynamic_factor from, dynamic_factor to) noexcept {
+      if (!from.valid() || !to.valid()) [[unlikely]] {
+        return T{};
+      }
+      std::int64_t num{}, den{};
+      if (__builtin_mul_overflow(from.num, to.den, &num) ||
+          __builtin_mul_overflow(from.den, to.num, &den)) [[unlikely]] {
+        const exact_ratio exact = exact_ratio{from.num, from.den} / exact_ratio{to.num, to.den};
+        if constexpr (std::is_integral_v<T>) {
+          return static_cast<T>(static_cast<exact_int>(value) * exact.num / exact.den);
+        } else {
+          return static_cast<T>(value * exact.template as<long double>());
+        }
+      }
+      if constexpr (std::is_integral_v<T>) {
+        return static_cast<T>(static_cast<exact_int>(value) * num / den);
+      } else {
+        using ratio_t = std::conditional_t<(sizeof(T) > sizeof(double)), long double, double>;
+        return value * static_cast<T>(static_cast<ratio_t>(num) / static_cast<ratio_t>(den));
+      }
+    }
+
+    //! Product of two factors. Only reduces when the plain product overflows, and folds the
+    //! factor into `value` when even the reduced product does not fit in 64 bits.
+    template <typename T>
+    constexpr dynamic_factor
+    multiply_factors(dynamic_factor lhs, dynamic_factor rhs, T& value) noexcept {
+      dynamic_factor result{};
+      if (!__builtin_mul_overflow(lhs.num, rhs.num, &result.num) &&
+          !__builtin_mul_overflow(lhs.den, rhs.den, &result.den)) [[likely]] {
+        return result;
+      }
+      const exact_ratio exact = exact_ratio{lhs.num, lhs.den} * exact_ratio{rhs.num, rhs.den};
+      if (fits_in<std::int64_t>(exact.num) && fits_in<std::int64_t>(exact.den)) {
+        return {static_cast<std::int64_t>(exact.num), static_cast<std::int64_t>(exact.den)};
+      }
+      value = static_cast<T>(value * exact.template as<long double>());
+      return {};
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Predicate that checks if unit `U` can be represented by a @ref dynamic_quantity
+   *
+   * All base scales `U` is made of must have a @ref quantify::base_dimension.
+   */
+  template <typename U>
+  concept DynamicallyDimensioned = has_scale<U> && requires {
+    requires detail::terms_dimension<typename canonical<typename U::scale>::terms>::known;
+  };
+
+  //! Packed dimension of unit (or scale) `U`
+  template <DynamicallyDimensioned U>
+  constexpr dimension dimension_of_v =
+    detail::terms_dimension<typename canonical<typename U::scale>::terms>::value();
+
+  //! Run-time factor of unit `U`, see @ref quantify::dynamic_factor
+  template <DynamicallyDimensioned U>
+  constexpr dynamic_factor dynamic_factor_of_v = [] {
+    constexpr exact_ratio F = unit_factor_v<U>;
+    static_assert(
+      detail::fits_in<std::int64_t>(F.num) && detail::fits_in<std::int64_t>(F.den),
+      "The factor of this unit does not fit in a 64-bit dynamic factor."
+    );
+    return dynamic_factor{static_cast<std::int64_t>(F.num), static_cast<std::int64_t>(F.den)};
+  }();
+
+  /*! @brief Quantity whose unit is only known at run-time
+   *
+   * Stores its value in the unit it was created with, next to the packed dimension and the
+   * factor of that unit. Converting from and back into a static @ref quantify::quantity of the
+   * same unit is exact. Converting into another unit of the same dimension uses the same
+   * factors as `quantity::as`.
+   *
+   * ```c++
+   * dynamic_quantity<double> d = Q<kilometer, double>{3.0};
+   * dynamic_quantity<double> t = Q<hours, double>{2.0};
+   * auto v = (d / t).as<frac<meter, seconds>>(); // std::expected holding 0.41(6) (m)/(s)
+   * auto e = (d + t).as<meter>();                // std::unexpected{std::errc::invalid_argument}
+   * ```
+   *
+   * @tparam T Underlying data type
+   */
+  template <typename T>
+  struct dynamic_quantity {
+    using data_type = T;
+
+    T              value{};
+    dimension      dim{};
+    dynamic_factor factor{};
+
+    constexpr dynamic_quantity() = default;
+
+    constexpr dynamic_quantity(T value_, dimension dim_, dynamic_factor factor_) noexcept
+        : value(value_), dim(dim_), factor(factor_) {
+    }
+
+    template <DynamicallyDimensioned U>
+    constexpr dynamic_quantity(const quantity<U, T>& q) noexcept
+        : value(q.value), dim(dimension_of_v<U>), factor(dynamic_factor_of_v<U>) {
+    }
+
+    //! Whether no operation on incompatible dimensions was involved in computing this quantity
+    [[nodiscard]]
+    constexpr bool valid() const noexcept {
+      return factor.valid();
+    }
+
+    //! Whether this quantity is valid and can be converted into unit `U`
+    template <DynamicallyDimensioned U>
+    [[nodiscard]]
+    constexpr bool is() const noexcept {
+      return valid() && dim == dimension_of_v<U>;
+    }
+
+    /*! @brief Converts into a static quantity of unit `U`
+     *
+     * @return The converted quantity, or `std::errc::invalid_argument` if this quantity is
+     *         invalid or its dimension is not that of `U`.
+     */
+    template <DynamicallyDimensioned U>
+    [[nodiscard]]
+    constexpr std::expected<quantity<U, T>, std::errc> as() const noexcept {
+      if (!is<U>()) [[unlikely]] {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      constexpr dynamic_factor to = dynamic_factor_of_v<U>;
+      if (factor == to) {
+        return quantity<U, T>{value};
+      }
+      return quantity<U, T>{detail::rescale(value, factor, to)};
+    }
+
+    //! Value of `rhs` expressed with the factor of this quantity
+    [[nodiscard]]
+    constexpr T value_of(const dynamic_quantity& rhs) const noexcept {
+      if (rhs.factor == factor) [[likely]] {
+        return rhs.value;
+      }
+      return detail::rescale(rhs.value, rhs.factor, factor);
+    }
+
+    constexpr dynamic_quantity operator+(const dynamic_quantity& rhs) const noexcept {
+      return {value + value_of(rhs), dim, compatible_factor(rhs)};
+    }
+
+    constexpr dynamic_quantity operator-(const dynamic_quantity& rhs) const noexcept {
+      return {value - value_of(rhs), dim, compatible_factor(rhs)};
+    }
+
+    constexpr dynamic_quantity& operator+=(const dynamic_quantity& rhs) noexcept {
+      return *this = *this + rhs;
+    }
+
+    constexpr dynamic_quantity& operator-=(const dynamic_quantity& rhs) noexcept {
+      return *this = *this - rhs;
+    }
+
+    constexpr dynamic_quantity operator*(const dynamic_quantity& rhs) const noexcept {
+      dynamic_quantity result{value * rhs.value, dim * rhs.dim, {}};
+      result.factor = detail::multiply_factors(factor, rhs.factor, result.value);
+      return result;
+    }
+
+    constexpr dynamic_quantity operator/(const dynamic_quantity& rhs) const noexcept {
+      dynamic_quantity result{value / rhs.value, dim / rhs.dim, {}};
+      result.factor = detail::multiply_factors(factor, rhs.factor.inverse(), result.value);
+      return result;
+    }
+
+    constexpr dynamic_quantity operator*(const T& rhs) const noexcept {
+      return {value * rhs, dim, factor};
+    }
+
+    constexpr dynamic_quantity operator/(const T& rhs) const noexcept {
+      return {value / rhs, dim, factor};
+    }
+
+    constexpr dynamic_quantity operator-() const noexcept {
+      return {-value, dim, factor};
+    }
+
+    //! Unordered if either quantity is invalid or their dimensions differ
+    constexpr std::partial_ordering operator<=>(const dynamic_quantity& rhs) const noexcept {
+      if (!valid() || !rhs.valid() || dim != rhs.dim) [[unlikely]] {
+        return std::partial_ordering::unordered;
+      }
+      return value <=> value_of(rhs);
+    }
+
+    constexpr bool operator==(const dynamic_quantity& rhs) const noexcept {
+      return valid() && rhs.valid() && dim == rhs.dim && value == value_of(rhs);
+    }
+
+  private:
+    //! Factor of the result of adding `rhs`, invalid unless both dimensions match
+    constexpr dynamic_factor compatible_factor(const dynamic_quantity& rhs) const noexcept {
+      const auto same = static_cast<std::int64_t>(dim == rhs.dim && rhs.valid());
+      return {factor.num * same, factor.den};
+    }
+  };
+
+  template <typename U, typename T>
+  dynamic_quantity(const quantity<U, T>&) -> dynamic_quantity<T>;
+
+  template <typename T>
+  constexpr dynamic_quantity<T> operator*(const T& lhs, const dynamic_quantity<T>& rhs) noexcept {
+    return rhs * lhs;
+  }
+} // namespace quantify
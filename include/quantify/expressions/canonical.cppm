@@ -0,0 +1,255 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  canonical.cppm
+ *  \brief Canonical (unit, exponent) representation of unit expressions
+ *
+ * Unit expressions made of `mul` and `frac` are normalized in three passes, each of which is a
+ * single pack expansion rather than a recursion over the pack:
+ *
+ *  1. **Flatten**: the expression is turned into a flat list of `term<Leaf, ±1>`, where a leaf is
+ *     any unit (or scale) that is not a `mul` or a `frac`. Inside a `mul`, nested products are
+ *     spliced in place and plain factors are listed before fractions.
+ *  2. **Combine**: terms referring to the same leaf are merged by adding their exponents, in a
+ *     single constant-evaluated pass over the terms. Each leaf is kept at the position of its
+ *     first occurrence and dropped if its exponent is zero.
+ *  3. **Emit**: leaves with positive exponents form the numerator and leaves with negative
+ *     exponents the denominator, each repeated as many times as its exponent.
+ *
+ * The instantiation depth is therefore bounded by the nesting depth of the expression, not by
+ * the amount of factors in it.
+ */
+
+export module quantify.core:canonical;
+import std;
+import :preface;
+
+export namespace quantify {
+  //! @cond NEVER
+  namespace detail {
+    template <typename... Ts>
+    struct type_list {};
+
+    //! Only used in unevaluated contexts to concatenate lists with a fold expression
+    template <typename... As, typename... Bs>
+    type_list<As..., Bs...> operator+(type_list<As...>, type_list<Bs...>);
+
+    template <typename... Lists>
+    using concat_t = decltype((type_list<>{} + ... + Lists{}));
+
+    template <typename T, std::size_t>
+    struct always {
+      using type = T;
+    };
+
+    template <typename T, std::size_t... I>
+    auto repeat_impl(std::index_sequence<I...>) -> type_list<typename always<T, I>::type...>;
+
+    template <typename T, int N>
+    using repeat_t = decltype(repeat_impl<T>(std::make_index_sequence<(N > 0 ? N : 0)>{}));
+
+    template <typename Leaf, int Exponent>
+    struct term {
+      using leaf                    = Leaf;
+      constexpr static int exponent = Exponent;
+    };
+
+    //* Flatten
+
+    template <typename Expr, int Sign>
+    struct flatten_terms {
+      using type = type_list<term<Expr, Sign>>;
+    };
+
+    template <int Sign>
+    struct flatten_terms<no_unit, Sign> {
+      using type = type_list<>;
+    };
+
+    template <typename N, typename D, int Sign>
+    struct flatten_terms<frac<N, D>, Sign> {
+      using type =
+        concat_t<typename flatten_terms<N, Sign>::type, typename flatten_terms<D, -Sign>::type>;
+    };
+
+    template <typename P>
+    struct mul_factors {
+      using type = type_list<P>;
+    };
+
+    template <typename... Ps>
+    struct mul_factors<mul<Ps...>> {
+      using type = concat_t<typename mul_factors<Ps>::type...>;
+    };
+
+    template <bool Select, typename Factor, int Sign>
+    using flatten_if_t = typename std::
+      conditional_t<Select, flatten_terms<Factor, Sign>, std::type_identity<type_list<>>>::type;
+
+    template <typename Factors, int Sign>
+    struct flatten_factors;
+
+    template <typename... Fs, int Sign>
+    struct flatten_factors<type_list<Fs...>, Sign> {
+      using type = concat_t<
+        flatten_if_t<!is_frac_v<Fs>, Fs, Sign>...,
+        flatten_if_t<is_frac_v<Fs>, Fs, Sign>...>;
+    };
+
+    template <typename... Ps, int Sign>
+    struct flatten_terms<mul<Ps...>, Sign> {
+      using type = typename flatten_factors<typename mul_factors<mul<Ps...>>::type, Sign>::type;
+    };
+
+    //* Combine
+
+    template <typename Leaf, typename... Terms>
+    constexpr int exponent_of =
+      (0 + ... + (std::is_same_v<Leaf, typename Terms::leaf> ? Terms::exponent : 0));
+
+    template <typename Terms>
+    struct combine;
+
+    template <>
+    struct combine<type_list<>> {
+      using type = type_list<>;
+    };
+
+    //! Distinct object per leaf: comparing addresses tells leaves apart in a constant expression
+    template <typename Leaf>
+    constexpr char leaf_tag = 0;
+
+    //! Exponent of each leaf at the position of its first occurrence, zero everywhere else
+    template <std::size_t N>
+    struct buckets {
+      std::array<int, N>  total{};
+      std::array<bool, N> first{};
+    };
+
+    template <typename... Terms>
+    struct combine<type_list<Terms...>> {
+    private:
+      static constexpr std::size_t size = sizeof...(Terms);
+
+      //! Assigns every term to the bucket of its leaf in a single pass, merging exponents as it
+      //! goes, so that the amount of instantiations is linear in the amount of terms.
+      static consteval buckets<size> bucket() {
+        constexpr const char*         tags[]      = {&leaf_tag<typename Terms::leaf>...};
+        constexpr int                 exponents[] = {Terms::exponent...};
+        buckets<size>                 result;
+        std::array<std::size_t, size> seen{};
+        std::size_t                   distinct = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+          std::size_t b = 0;
+          while (b < distinct && tags[seen[b]] != tags[i]) {
+            ++b;
+          }
+          if (b == distinct) {
+            seen[distinct++] = i;
+            result.first[i]  = true;
+          }
+          result.total[seen[b]] += exponents[i];
+        }
+        return result;
+      }
+
+      static constexpr buckets<size> merged = bucket();
+
+      template <std::size_t... I>
+      static auto select(std::index_sequence<I...>) -> concat_t<std::conditional_t<
+        merged.first[I] && merged.total[I] != 0,
+        type_list<term<typename Terms::leaf, merged.total[I]>>,
+        type_list<>>...>;
+
+    public:
+      using type = decltype(select(std::index_sequence_for<Terms...>{}));
+    };
+
+    //* Emit
+
+    template <typename Leaves>
+    struct as_product {
+      using type = Leaves;
+    };
+
+    template <>
+    struct as_product<type_list<>> {
+      using type = no_unit;
+    };
+
+    template <typename Leaf>
+    struct as_product<type_list<Leaf>> {
+      using type = Leaf;
+    };
+
+    template <typename... Leaves>
+      requires(sizeof...(Leaves) > 1)
+    struct as_product<type_list<Leaves...>> {
+      using type = mul<Leaves...>;
+    };
+
+    template <typename Terms>
+    struct emit;
+
+    template <typename... Terms>
+    struct emit<type_list<Terms...>> {
+    private:
+      using numerator   = concat_t<repeat_t<typename Terms::leaf, Terms::exponent>...>;
+      using denominator = concat_t<repeat_t<typename Terms::leaf, -Terms::exponent>...>;
+
+    public:
+      using type = std::conditional_t<
+        std::is_same_v<denominator, type_list<>>,
+        typename as_product<numerator>::type,
+        frac<typename as_product<numerator>::type, typename as_product<denominator>::type>>;
+    };
+
+    template <typename TermsA, typename TermsB>
+    struct same_terms: std::false_type {};
+
+    template <typename... As, typename... Bs>
+    struct same_terms<type_list<As...>, type_list<Bs...>>
+        : std::bool_constant<
+            sizeof...(As) == sizeof...(Bs) &&
+            ((exponent_of<typename As::leaf, Bs...> == As::exponent) && ...)> {};
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Canonical form of a unit expression
+   *
+   * `terms` lists each distinct unit in the expression once, along with its total exponent.
+   * `type` is the simplest `mul`/`frac` expression with those exponents, which is what
+   * @ref quantify::reduce yields for products and fractions.
+   *
+   * @tparam Expr Unit (or scale) expression
+   */
+  template <typename Expr>
+  struct canonical {
+    using terms = typename detail::combine<typename detail::flatten_terms<Expr, 1>::type>::type;
+    using type  = typename detail::emit<terms>::type;
+  };
+
+  //! See @ref quantify::canonical
+  template <typename Expr>
+  using canonical_t = typename canonical<Expr>::type;
+
+  /*! @brief Predicate that checks if two unit (or scale) expressions have the same exponents
+   *
+   * The order in which units appear in either expression is irrelevant.
+   */
+  template <typename A, typename B>
+  constexpr bool same_dimensions_v =
+    detail::same_terms<typename canonical<A>::terms, typename canonical<B>::terms>::value;
+} // namespace quantify
@@ -18,11 +18,12 @@ module;
 export module quantify.core:frac;
 import std;
 import :preface;
+import :factor;
 
 export namespace quantify {
   template<typename Numerator, typename Denominator>
   struct frac {
-    UNIT_SYMBOL("(" + Numerator::symbol() + ")/(" + Denominator::symbol() + ")")
+    UNIT_SYMBOL("(" + Numerator::symbol_literal() + ")/(" + Denominator::symbol_literal() + ")")
   };
 
   template<typename Numerator, typename Denominator>
@@ -34,12 +35,8 @@ export namespace quantify {
     using scale  = frac<typename Numerator::scale, typename Denominator::scale>;
 
     template<typename T>
-    using factor = ratio<
-      T,
-      (long)(Numerator::template factor<T>::numerator * Denominator::template factor<T>::denominator),
-      (long)(Numerator::template factor<T>::denominator * Denominator::template factor<T>::numerator)
-    >;
+    using factor = typename unit_ratio<T, frac>::type;
 
-    UNIT_SYMBOL("(" + Numerator::symbol() + ")/(" + Denominator::symbol() + ")")
+    UNIT_SYMBOL("(" + Numerator::symbol_literal() + ")/(" + Denominator::symbol_literal() + ")")
   };
 }
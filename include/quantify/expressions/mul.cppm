@@ -19,28 +19,29 @@ module;
 export module quantify.core:mul;
 import std;
 import :preface;
+import :factor;
 import :frac;
 
 export namespace quantify {
   template <typename... Products>
   struct mul {
-    UNIT_SYMBOL(symbol_builder<Products...>::symbol())
+    UNIT_SYMBOL(symbol_builder<Products...>::symbol_literal())
 
   private:
     template <typename...>
     struct symbol_builder {
-      UNIT_SYMBOL(no_unit::symbol())
+      UNIT_SYMBOL(no_unit::symbol_literal())
     };
 
     template <typename P>
     struct symbol_builder<P> {
-      UNIT_SYMBOL(P::symbol())
+      UNIT_SYMBOL(P::symbol_literal())
     };
 
     template <typename P, typename... Ps>
       requires (sizeof...(Ps) > 0)
     struct symbol_builder<P, Ps...> {
-      UNIT_SYMBOL(P::symbol() + "*" + symbol_builder<Ps...>::symbol())
+      UNIT_SYMBOL(P::symbol_literal() + "*" + symbol_builder<Ps...>::symbol_literal())
     };
   };
 
@@ -51,29 +52,25 @@ export namespace quantify {
     // using reduce = typename ts::packs::flatten<mul<typename Products::reduce...>>::type;
 
     template <typename T>
-    using factor = ratio<
-      T,
-      (long)(1 * ... * Products::template factor<T>::numerator),
-      (long)(1 * ... * Products::template factor<T>::denominator)
-    >;
+    using factor = typename unit_ratio<T, mul>::type;
 
-    UNIT_SYMBOL(symbol_builder<Products...>::symbol())
+    UNIT_SYMBOL(symbol_builder<Products...>::symbol_literal())
 
   private:
     template <typename...>
     struct symbol_builder {
-      UNIT_SYMBOL(no_unit::symbol())
+      UNIT_SYMBOL(no_unit::symbol_literal())
     };
 
     template <typename P>
     struct symbol_builder<P> {
-      UNIT_SYMBOL(P::symbol())
+      UNIT_SYMBOL(P::symbol_literal())
     };
 
     template <typename P, typename... Ps>
       requires (sizeof...(Ps) > 0)
     struct symbol_builder<P, Ps...> {
-      UNIT_SYMBOL(P::symbol() + "*" + symbol_builder<Ps...>::symbol())
+      UNIT_SYMBOL(P::symbol_literal() + "*" + symbol_builder<Ps...>::symbol_literal())
     };
   };
 }
@@ -0,0 +1,221 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  format.cppm
+ *  \brief `std::format` support for quantities
+ *
+ */
+
+export module quantify.format;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  /*! @brief Formatting adaptor that writes a quantity converted to another unit.
+   *
+   * Produced by @ref quantify::format_as. The conversion is performed while formatting, no
+   * intermediate quantity is stored.
+   *
+   * @tparam U_TO Unit to format the value in
+   * @tparam U Unit of the referenced quantity
+   * @tparam T Underlying data type of the referenced quantity
+   */
+  template <typename U_TO, typename U, typename T>
+  struct formatted_as {
+    const quantity<U, T>& ref;
+  };
+
+  /*! @brief Formats a quantity in unit `U_TO`
+   *
+   * ```c++
+   * std::format("{:.2f}", quantify::format_as<kilometer>(distance)); // "1.23 km"
+   * ```
+   */
+  template <typename U_TO, typename U, typename T>
+    requires requires(const quantity<U, T>& q) { q.template as<U_TO>(); }
+  constexpr formatted_as<U_TO, U, T> format_as(const quantity<U, T>& q) noexcept {
+    return {q};
+  }
+
+  //! @cond NEVER
+  namespace detail {
+    /*! Parsed representation of a quantity format spec:
+     *
+     *     spec      ::= [ "." precision ] [ type ] [ unit_mode ]
+     *     precision ::= digits, at most max_precision
+     *     type      ::= "a" | "e" | "f" | "g"
+     *     unit_mode ::= "u" (value and unit, default) | "n" (value only)
+     */
+    struct quantity_format_spec {
+      //! Largest precision accepted, which keeps parsing from overflowing `int`
+      static constexpr int max_precision = 4096;
+
+      int                              precision = -1;
+      std::optional<std::chars_format> type{};
+      bool                             show_unit = true;
+
+      template <typename T, typename ParseContext>
+      constexpr typename ParseContext::iterator parse(ParseContext& ctx) {
+        auto it  = ctx.begin();
+        auto end = ctx.end();
+
+        if (it != end && *it == '.') {
+          ++it;
+          if (it == end || *it < '0' || *it > '9') {
+            throw std::format_error("quantify: expected precision after '.'");
+          }
+          precision = 0;
+          while (it != end && *it >= '0' && *it <= '9') {
+            precision = precision * 10 + (*it - '0');
+            if (precision > max_precision) {
+              throw std::format_error("quantify: precision is too large");
+            }
+            ++it;
+          }
+        }
+
+        if (it != end) {
+          switch (*it) {
+            case 'a': type = std::chars_format::hex; break;
+            case 'e': type = std::chars_format::scientific; break;
+            case 'f': type = std::chars_format::fixed; break;
+            case 'g': type = std::chars_format::general; break;
+            default: break;
+          }
+          if (type) {
+            ++it;
+          }
+        }
+
+        if (it != end) {
+          if (*it == 'u' || *it == 'n') {
+            show_unit = (*it == 'u');
+            ++it;
+          }
+        }
+
+        if (it != end && *it != '}') {
+          throw std::format_error("quantify: invalid quantity format spec");
+        }
+        if constexpr (std::is_integral_v<T>) {
+          if (precision >= 0 || type) {
+            throw std::format_error(
+              "quantify: precision and floating point types are not allowed for integral values"
+            );
+          }
+        }
+        return it;
+      }
+
+      template <typename T>
+      std::to_chars_result to_chars(char* first, char* last, const T& value) const {
+        const auto format = type.value_or(std::chars_format::general);
+        if (precision >= 0) {
+          return std::to_chars(first, last, value, format, precision);
+        } else if (type) {
+          return std::to_chars(first, last, value, format);
+        } else {
+          return std::to_chars(first, last, value);
+        }
+      }
+
+      /*! Longest text `to_chars` can write for a `T`: every digit of the largest and of the
+       *  smallest value in fixed notation, the requested precision, a sign, a point and an
+       *  exponent.
+       */
+      template <typename T>
+      std::size_t max_chars() const noexcept {
+        using limits = std::numeric_limits<T>;
+        return static_cast<std::size_t>(
+                 limits::max_exponent10 - limits::min_exponent10 + 2 * limits::max_digits10 + 16
+               ) +
+               static_cast<std::size_t>(std::max(precision, 0));
+      }
+
+      template <typename T, typename OutputIt>
+      OutputIt write_value(const T& value, OutputIt out) const {
+        if constexpr (std::is_floating_point_v<T>) {
+          char       buffer[128];
+          const auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+          if (result.ec == std::errc{}) [[likely]] {
+            return std::copy(buffer, result.ptr, out);
+          }
+
+          // Large values in fixed notation, or large precisions, need a larger buffer
+          std::string large(max_chars<T>(), '\0');
+          const auto  retry = to_chars(large.data(), large.data() + large.size(), value);
+          if (retry.ec != std::errc{}) {
+            throw std::format_error("quantify: the value does not fit in the output buffer");
+          }
+          return std::copy(large.data(), retry.ptr, out);
+        } else if constexpr (std::is_integral_v<T>) {
+          // Digits, sign and one more digit, which digits10 does not count
+          char       buffer[std::numeric_limits<T>::digits10 + 2];
+          const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+          return std::copy(buffer, result.ptr, out);
+        } else {
+          return std::format_to(out, "{}", value);
+        }
+      }
+
+      template <typename U, typename OutputIt>
+      OutputIt write_unit(OutputIt out) const {
+        if (show_unit) {
+          *out++ = ' ';
+          out    = std::ranges::copy(U::symbol_view(), out).out;
+        }
+        return out;
+      }
+    };
+  } // namespace detail
+  //! @endcond
+} // namespace quantify
+
+/*! @brief Formats a quantity as its value followed by its unit symbol.
+ *
+ * Writes directly into the output iterator through `std::to_chars`, without intermediate
+ * strings. See @ref quantify::detail::quantity_format_spec for the accepted format spec.
+ */
+template <typename U, typename T>
+struct std::formatter<quantify::quantity<U, T>, char> {
+  quantify::detail::quantity_format_spec spec{};
+
+  constexpr auto parse(std::format_parse_context& ctx) {
+    return spec.template parse<T>(ctx);
+  }
+
+  template <typename FormatContext>
+  auto format(const quantify::quantity<U, T>& q, FormatContext& ctx) const {
+    auto out = spec.write_value(q.value, ctx.out());
+    return spec.template write_unit<U>(out);
+  }
+};
+
+/*! @brief Formats a quantity converted to another unit, see @ref quantify::format_as
+ */
+template <typename U_TO, typename U, typename T>
+struct std::formatter<quantify::formatted_as<U_TO, U, T>, char> {
+  quantify::detail::quantity_format_spec spec{};
+
+  constexpr auto parse(std::format_parse_context& ctx) {
+    return spec.template parse<T>(ctx);
+  }
+
+  template <typename FormatContext>
+  auto format(const quantify::formatted_as<U_TO, U, T>& q, FormatContext& ctx) const {
+    auto out = spec.write_value(q.ref.template as<U_TO>().value, ctx.out());
+    return spec.template write_unit<U_TO>(out);
+  }
+};
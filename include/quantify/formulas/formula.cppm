@@ -0,0 +1,344 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  formula.cppm
+ *  \brief Equations between named variables, rearranged and compiled at compile-time
+ *
+ * A formula is an equation `Lhs = Rhs` where both sides are `mul`/`frac` expressions of
+ * variables. Variables are plain tag types, so the same canonical form that reduces units also
+ * rearranges formulas: isolating `V` in `Lhs = Rhs` is reducing `V / (Lhs / Rhs)` if `V` has
+ * an exponent of `+1` in `Lhs / Rhs`, or `(Lhs / Rhs) * V` if it has an exponent of `-1`.
+ */
+
+export module quantify.formulas:formula;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  /*! @brief Named variable of a formula
+   *
+   * Variables are declared as empty types deriving from this template, e.g.
+   * `struct mass: variable<mass::scale> {};`. Any quantity whose unit belongs to `Scale` can be
+   * substituted for it.
+   *
+   * @tparam Scale Scale, or expression of scales, of the quantities the variable stands for
+   */
+  template <typename Scale>
+  struct variable {
+    using scale = Scale;
+  };
+
+  template <typename V>
+  concept FormulaVariable = std::derived_from<V, variable<typename V::scale>>;
+
+  //! @cond NEVER
+  namespace detail {
+    //! `Expr` with every variable `V` in it replaced by `Map::template unit_of<V>`
+    template <typename Expr, typename Map>
+    struct substitute_leaves {
+      using type = typename Map::template unit_of<Expr>;
+    };
+
+    template <typename Map>
+    struct substitute_leaves<no_unit, Map> {
+      using type = no_unit;
+    };
+
+    template <typename... Ps, typename Map>
+    struct substitute_leaves<mul<Ps...>, Map> {
+      using type = mul<typename substitute_leaves<Ps, Map>::type...>;
+    };
+
+    template <typename N, typename D, typename Map>
+    struct substitute_leaves<frac<N, D>, Map> {
+      using type =
+        frac<typename substitute_leaves<N, Map>::type, typename substitute_leaves<D, Map>::type>;
+    };
+
+    template <typename Expr, typename Map>
+    using substitute_leaves_t = typename substitute_leaves<Expr, Map>::type;
+
+    struct variable_scales {
+      template <typename V>
+      using unit_of = typename V::scale;
+    };
+
+    template <typename V, typename... Vars>
+    consteval std::size_t index_of() {
+      constexpr bool same[] = {std::is_same_v<V, Vars>...};
+      for (std::size_t i = 0; i < sizeof...(Vars); ++i) {
+        if (same[i]) {
+          return i;
+        }
+      }
+      return sizeof...(Vars);
+    }
+
+    template <typename Vars, typename Units>
+    struct variable_units;
+
+    template <typename... Vars, typename... Units>
+    struct variable_units<type_list<Vars...>, type_list<Units...>> {
+      template <typename V>
+      using unit_of = std::tuple_element_t<index_of<V, Vars...>(), std::tuple<Units...>>;
+    };
+
+    //! Value of the expression `Expr` of `Vars...`, given the values of `Vars...` in order
+    template <typename Expr, typename... Vars>
+    struct expression_value {
+      template <typename T, typename... Ts>
+      static constexpr T eval(const Ts&... values) noexcept {
+        return std::get<index_of<Expr, Vars...>()>(std::tie(values...));
+      }
+    };
+
+    template <typename... Vars>
+    struct expression_value<no_unit, Vars...> {
+      template <typename T, typename... Ts>
+      static constexpr T eval(const Ts&...) noexcept {
+        return T{1};
+      }
+    };
+
+    template <typename... Ps, typename... Vars>
+    struct expression_value<mul<Ps...>, Vars...> {
+      template <typename T, typename... Ts>
+      static constexpr T eval(const Ts&... values) noexcept {
+        return (expression_value<Ps, Vars...>::template eval<T>(values...) * ...);
+      }
+    };
+
+    template <typename N, typename D, typename... Vars>
+    struct expression_value<frac<N, D>, Vars...> {
+      template <typename T, typename... Ts>
+      static constexpr T eval(const Ts&... values) noexcept {
+        return expression_value<N, Vars...>::template eval<T>(values...) /
+               expression_value<D, Vars...>::template eval<T>(values...);
+      }
+    };
+
+    template <typename List>
+    constexpr std::size_t list_size = 0;
+
+    template <typename... Ts>
+    constexpr std::size_t list_size<type_list<Ts...>> = sizeof...(Ts);
+
+    template <typename Terms>
+    struct leaves_of;
+
+    template <typename... Terms>
+    struct leaves_of<type_list<Terms...>> {
+      using type = type_list<typename Terms::leaf...>;
+    };
+
+    template <typename V, typename Terms>
+    constexpr int exponent_in = 0;
+
+    template <typename V, typename... Terms>
+    constexpr int exponent_in<V, type_list<Terms...>> = exponent_of<V, Terms...>;
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Compiled form of an isolated formula, taking its variables in the order `Vars...`
+   *
+   * The whole expression is evaluated on the raw values of its arguments. The unit of the
+   * result is deduced from the units of the arguments the same way the quantity operators would
+   * deduce it, and any conversion into a requested unit is folded into a single constant.
+   *
+   * @tparam Expression `mul`/`frac` expression of variables that computes the isolated variable
+   * @tparam Vars Order in which the variables of `Expression` are passed
+   */
+  template <typename Expression, FormulaVariable... Vars>
+  struct formula_kernel {
+    using free_variables = typename detail::leaves_of<typename canonical<Expression>::terms>::type;
+
+    static_assert(
+      sizeof...(Vars) == detail::list_size<free_variables> &&
+        ((detail::exponent_in<Vars, typename canonical<Expression>::terms> != 0) && ...),
+      "The kernel must take each variable of the formula exactly once."
+    );
+
+    //! Unit of the result for arguments in units `Units...`
+    template <typename... Units>
+    using unit_t = reduce<detail::substitute_leaves_t<
+      Expression, detail::variable_units<detail::type_list<Vars...>, detail::type_list<Units...>>>>;
+
+    //! Whether `Qs...` are quantities of the scales of `Vars...`, in order
+    template <typename... Qs>
+    static consteval bool accepts() {
+      if constexpr (sizeof...(Qs) != sizeof...(Vars) || !(QuantityConcept<Qs> && ...)) {
+        return false;
+      } else {
+        return (CompareScales<typename Qs::unit::scale, typename Vars::scale> && ...);
+      }
+    }
+
+    //! Evaluates the formula, in the unit deduced from the units of `qs...`
+    template <typename... Qs>
+      requires(accepts<Qs...>())
+    [[nodiscard]]
+    constexpr auto operator()(const Qs&... qs) const noexcept {
+      using T = std::common_type_t<typename Qs::data_type...>;
+      return quantity<unit_t<typename Qs::unit...>, T>{
+        detail::expression_value<Expression, Vars...>::template eval<T>(qs.value...)
+      };
+    }
+
+    //! Evaluates the formula in unit `U`, with every conversion folded into a single factor
+    template <typename U, typename... Qs>
+      requires(accepts<Qs...>()) && SameScale<U, unit_t<typename Qs::unit...>>
+    [[nodiscard]]
+    constexpr auto as(const Qs&... qs) const noexcept {
+      using T                 = std::common_type_t<typename Qs::data_type...>;
+      constexpr exact_ratio f = conversion_factor_v<unit_t<typename Qs::unit...>, U>;
+      return quantity<U, T>{apply_factor<f>(
+        detail::expression_value<Expression, Vars...>::template eval<T>(qs.value...)
+      )};
+    }
+
+    /*! @brief Evaluates the formula element-wise over contiguous ranges of quantities
+     *
+     * The result is written in the unit of the elements of `out`. The conversion factor is
+     * folded once for the whole loop, whose body is the bare arithmetic of the formula. Every
+     * input range must have as many elements as `out`, otherwise nothing is written and
+     * `std::errc::invalid_argument` is returned.
+     */
+    template <std::ranges::contiguous_range Out, std::ranges::contiguous_range... Ranges>
+      requires(accepts<std::ranges::range_value_t<Ranges>...>()) &&
+               QuantityConcept<std::ranges::range_value_t<Out>>
+    [[nodiscard]]
+    constexpr std::expected<void, std::errc>
+    eval_into(Out&& out, const Ranges&... inputs) const noexcept {
+      using R                 = std::ranges::range_value_t<Out>;
+      using T                 = typename R::data_type;
+      using U_nat             = unit_t<typename std::ranges::range_value_t<Ranges>::unit...>;
+      constexpr exact_ratio f = conversion_factor_v<U_nat, typename R::unit>;
+
+      auto*             dst = std::ranges::data(out);
+      const std::size_t n   = std::ranges::size(out);
+      if (((std::ranges::size(inputs) != n) || ...)) [[unlikely]] {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        dst[i].value = apply_factor<f>(
+          detail::expression_value<Expression, Vars...>::template eval<T>(
+            std::ranges::data(inputs)[i].value...
+          )
+        );
+      }
+      return {};
+    }
+  };
+
+  /*! @brief Formula with variables `Bound...` already substituted by `values`
+   *
+   * Returned by @ref quantify::isolated::substitute. Substituting the last free variable
+   * evaluates the formula and returns its result.
+   */
+  template <typename Expression, typename Bound, typename... Qs>
+  struct partial_formula;
+
+  template <typename Expression, typename... Bound, typename... Qs>
+  struct partial_formula<Expression, detail::type_list<Bound...>, Qs...> {
+    std::tuple<Qs...> values;
+
+    template <FormulaVariable V, QuantityConcept Q>
+    [[nodiscard]]
+    constexpr auto substitute(const Q& q) const noexcept {
+      using terms = typename canonical<Expression>::terms;
+      static_assert(
+        detail::exponent_in<V, terms> != 0, "This variable does not appear in the formula."
+      );
+      static_assert(!(std::is_same_v<V, Bound> || ...), "This variable is already substituted.");
+
+      if constexpr (sizeof...(Bound) + 1 == detail::list_size<terms>) {
+        return std::apply(
+          [&](const Qs&... qs) { return formula_kernel<Expression, Bound..., V>{}(qs..., q); },
+          values
+        );
+      } else {
+        return partial_formula<Expression, detail::type_list<Bound..., V>, Qs..., Q>{
+          std::tuple_cat(values, std::tuple<Q>{q})
+        };
+      }
+    }
+  };
+
+  /*! @brief Formula `Formula` solved for variable `V`
+   *
+   * `expression` is the canonical `mul`/`frac` expression of the other variables that equals
+   * `V`. Only variables with an exponent of one can be isolated.
+   *
+   * @tparam Formula @ref quantify::formula the variable is isolated from
+   * @tparam V Variable to isolate
+   */
+  template <typename Formula, FormulaVariable V>
+  struct isolated {
+  private:
+    using ratio = frac<typename Formula::lhs, typename Formula::rhs>;
+
+    static constexpr int exponent = detail::exponent_in<V, typename canonical<ratio>::terms>;
+    static_assert(exponent != 0, "This variable does not appear in the formula.");
+    static_assert(
+      exponent == 1 || exponent == -1,
+      "Only variables with an exponent of 1 can be isolated, roots are not supported."
+    );
+
+  public:
+    using expression =
+      std::conditional_t<exponent == 1, canonical_t<frac<V, ratio>>, canonical_t<mul<ratio, V>>>;
+
+    //! Compiled formula taking its variables in the order `Vars...`
+    template <FormulaVariable... Vars>
+    static constexpr formula_kernel<expression, Vars...> with{};
+
+    //! Substitutes variable `W` by `q`, see @ref quantify::partial_formula
+    template <FormulaVariable W, QuantityConcept Q>
+    [[nodiscard]]
+    static constexpr auto substitute(const Q& q) noexcept {
+      return partial_formula<expression, detail::type_list<>>{}.template substitute<W>(q);
+    }
+  };
+
+  /*! @brief Equation `Lhs = Rhs` between variables
+   *
+   * Both sides are `mul`/`frac` expressions of @ref quantify::variable types, and must have the
+   * same dimensions. Formulas are declared once and solved for any of their variables with
+   * `isolate<V>`, e.g. for Newton's second law:
+   *
+   * ```cpp
+   * using second_law = formula<force, mul<mass, acceleration>>;
+   * auto a = second_law::isolate<acceleration>::substitute<force>(f).substitute<mass>(m);
+   * ```
+   *
+   * @tparam Lhs Left-hand side
+   * @tparam Rhs Right-hand side
+   */
+  template <typename Lhs, typename Rhs>
+  struct formula {
+    using lhs = Lhs;
+    using rhs = Rhs;
+
+    static_assert(
+      same_dimensions_v<
+        detail::substitute_leaves_t<Lhs, detail::variable_scales>,
+        detail::substitute_leaves_t<Rhs, detail::variable_scales>>,
+      "Both sides of a formula must have the same dimensions."
+    );
+
+    template <FormulaVariable V>
+    using isolate = isolated<formula, V>;
+  };
+} // namespace quantify
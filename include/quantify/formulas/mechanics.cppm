@@ -0,0 +1,98 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  mechanics.cppm
+ *  \brief Formulas of classical mechanics
+ *
+ */
+
+export module quantify.formulas:mechanics;
+import std;
+import quantify.core;
+import quantify.scales.distance;
+import quantify.scales.energy;
+import quantify.scales.force;
+import quantify.scales.mass;
+import quantify.scales.power;
+import quantify.scales.pressure;
+import quantify.scales.speed;
+import quantify.scales.time;
+import :formula;
+
+export namespace quantify::mechanics {
+  //! @addtogroup formulas Formulas
+  //! @{
+
+  //! Uniform motion, `distance = speed * time`
+  namespace uniform_motion {
+    struct distance: variable<quantify::distance::scale> {};
+    struct speed: variable<quantify::speed::scale> {};
+    struct time: variable<quantify::time::scale> {};
+
+    using equation = formula<distance, mul<speed, time>>;
+    template <FormulaVariable V>
+    using isolate = equation::isolate<V>;
+  } // namespace uniform_motion
+
+  namespace newton {
+    //! Newton's second law, `force = mass * acceleration`
+    namespace second_law {
+      struct force: variable<quantify::force::scale> {};
+      struct mass: variable<quantify::mass::scale> {};
+      struct acceleration
+          : variable<frac<quantify::distance::scale,
+                          mul<quantify::time::scale, quantify::time::scale>>> {};
+
+      using equation = formula<force, mul<mass, acceleration>>;
+      template <FormulaVariable V>
+      using isolate = equation::isolate<V>;
+    } // namespace second_law
+  } // namespace newton
+
+  //! Work done by a constant force along its direction, `work = force * distance`
+  namespace work {
+    struct work: variable<quantify::energy::scale> {};
+    struct force: variable<quantify::force::scale> {};
+    struct distance: variable<quantify::distance::scale> {};
+
+    using equation = formula<work, mul<force, distance>>;
+    template <FormulaVariable V>
+    using isolate = equation::isolate<V>;
+  } // namespace work
+
+  //! Average power, `power = energy / time`
+  namespace power {
+    struct power: variable<quantify::power::scale> {};
+    struct energy: variable<quantify::energy::scale> {};
+    struct time: variable<quantify::time::scale> {};
+
+    using equation = formula<power, frac<energy, time>>;
+    template <FormulaVariable V>
+    using isolate = equation::isolate<V>;
+  } // namespace power
+
+  //! Pressure exerted by a force over an area, `pressure = force / area`
+  namespace pressure {
+    struct pressure: variable<quantify::pressure::scale> {};
+    struct force: variable<quantify::force::scale> {};
+    struct area: variable<mul<quantify::distance::scale, quantify::distance::scale>> {};
+
+    using equation = formula<pressure, frac<force, area>>;
+    template <FormulaVariable V>
+    using isolate = equation::isolate<V>;
+  } // namespace pressure
+
+  //! @}
+} // namespace quantify::mechanics
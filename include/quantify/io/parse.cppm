@@ -0,0 +1,428 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  parse.cppm
+ *  \brief Parsing quantities from text
+ *
+ * Quantities are read as a number followed by a unit symbol, in the same format
+ * @ref quantify::quantity::to_string writes them: `"12.5 (km)/(hours)"`. The parentheses around
+ * the operands of a fraction are optional, so `"12.5 km/hours"` is accepted too.
+ *
+ * The unit is parsed following the structure of the requested unit: every leaf unit of the
+ * requested `mul`/`frac` expression is looked up in a symbol table built at compile-time from
+ * @ref quantify::all_units. Each table only holds the units that can be converted into that
+ * leaf, which is what tells apart symbols shared by several scales, such as `T` (teslas and
+ * tons) or `C` (coulombs and degrees Celsius). Parsing never allocates.
+ */
+
+export module quantify.io:parse;
+import std;
+import quantify.core;
+import quantify.conversion;
+import quantify.scales;
+
+export namespace quantify {
+  //! @cond NEVER
+  namespace detail {
+    //! FNV-1a hash of `str`, perturbed by `seed`
+    constexpr std::uint64_t symbol_hash(std::string_view str, std::uint64_t seed) noexcept {
+      std::uint64_t hash = 0xcbf29ce484222325ULL ^ (seed * 0x9e3779b97f4a7c15ULL);
+      for (const char c: str) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+      }
+      return hash ^ (hash >> 32);
+    }
+
+    constexpr bool is_symbol_delimiter(char c) noexcept {
+      return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '(' || c == ')' || c == '*' ||
+             c == '/' || c == ',' || c == ';';
+    }
+
+    //! Whether `symbol` can be read as a single token, i.e. whether it can be looked up
+    constexpr bool is_symbol_token(std::string_view symbol) noexcept {
+      return !symbol.empty() && std::ranges::none_of(symbol, is_symbol_delimiter);
+    }
+
+    //! A symbol that may be parsed in place of a unit, and the exact map into it
+    struct symbol_entry {
+      std::string_view symbol{};
+      affine_map       map{};
+    };
+
+    template <typename X, typename L>
+    concept ParsesAs = LinearlyConvertibleTo<X, L>;
+
+    //! Entry of `X` in the table of `L`, with the exact map between both
+    template <typename X, typename L>
+    consteval symbol_entry make_symbol_entry() {
+      return {X::symbol_view(), linear_conversion<X, L, double>::map};
+    }
+
+    //! `L` itself followed by every catalogued unit that can be converted into `L`
+    template <typename L>
+    consteval auto make_symbol_entries() {
+      constexpr std::size_t count = []<typename... Xs>(unit_list<Xs...>) {
+        return (std::size_t{1} + ... + ((!std::same_as<Xs, L> && ParsesAs<Xs, L>) ? 1 : 0));
+      }(all_units{});
+
+      std::array<symbol_entry, count> entries{};
+      std::size_t                     i = 0;
+      entries[i++]                      = make_symbol_entry<L, L>();
+      all_units::for_each([&]<typename X>() {
+        if constexpr (!std::same_as<X, L> && ParsesAs<X, L>) {
+          entries[i++] = make_symbol_entry<X, L>();
+        }
+      });
+      return entries;
+    }
+
+    template <std::size_t N>
+    consteval bool has_duplicate_symbols(const std::array<symbol_entry, N>& entries) {
+      for (std::size_t i = 0; i < N; ++i) {
+        for (std::size_t j = i + 1; j < N; ++j) {
+          if (entries[i].symbol == entries[j].symbol) {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    //! Smallest seed for which `symbol_hash` maps every symbol to a different slot
+    template <std::size_t Slots, std::size_t N>
+    consteval std::uint64_t find_symbol_seed(const std::array<symbol_entry, N>& entries) {
+      for (std::uint64_t seed = 0;; ++seed) {
+        std::array<bool, Slots> used{};
+        bool                    collision = false;
+        for (const auto& entry: entries) {
+          const auto slot = symbol_hash(entry.symbol, seed) & (Slots - 1);
+          collision       = collision || used[slot];
+          used[slot]      = true;
+        }
+        if (!collision) {
+          return seed;
+        }
+      }
+    }
+
+    //! Maps every slot to one plus the index of the entry hashed into it, or zero if empty
+    template <std::size_t Slots, std::size_t N>
+    consteval auto
+    make_symbol_slots(const std::array<symbol_entry, N>& entries, std::uint64_t seed) {
+      std::array<std::uint16_t, Slots> slots{};
+      for (std::size_t i = 0; i < N; ++i) {
+        slots[symbol_hash(entries[i].symbol, seed) & (Slots - 1)] =
+          static_cast<std::uint16_t>(i + 1);
+      }
+      return slots;
+    }
+
+    /*! Perfect-hash table of the symbols that may be parsed in place of unit `L`.
+     *
+     * Built at compile-time; a lookup hashes the symbol once and compares it with a single
+     * candidate.
+     */
+    template <typename L>
+    struct symbol_table {
+      static constexpr auto entries = make_symbol_entries<L>();
+      static_assert(
+        !has_duplicate_symbols(entries),
+        "Two units convertible to this unit share the same symbol."
+      );
+
+      static constexpr std::size_t   slot_count = std::bit_ceil(4 * entries.size());
+      static constexpr std::uint64_t seed       = find_symbol_seed<slot_count>(entries);
+      static constexpr auto          slots      = make_symbol_slots<slot_count>(entries, seed);
+
+      [[nodiscard]]
+      static constexpr const symbol_entry* find(std::string_view symbol) noexcept {
+        const std::uint16_t slot = slots[symbol_hash(symbol, seed) & (slot_count - 1)];
+        if (slot == 0 || entries[slot - 1].symbol != symbol) {
+          return nullptr;
+        }
+        return &entries[slot - 1];
+      }
+    };
+
+    //! Exact map `scale * x + offset` from the parsed unit into the requested one
+    struct unit_map {
+      exact_ratio scale{};
+      exact_ratio offset{0, 1};
+
+      //! Composes `scale` with `factor`, only reducing when the plain product overflows
+      constexpr void scale_by(const exact_ratio& factor) noexcept {
+        exact_ratio product{1, 1, scale.overflow || factor.overflow};
+        if (__builtin_mul_overflow(scale.num, factor.num, &product.num) ||
+            __builtin_mul_overflow(scale.den, factor.den, &product.den)) [[unlikely]] {
+          product = scale * factor;
+        }
+        scale = product;
+      }
+
+      [[nodiscard]]
+      constexpr bool identity() const noexcept {
+        return scale.num == scale.den && offset.num == 0;
+      }
+    };
+
+    /*! Parses the symbol of unit `U` from `[first, last)`, accumulating its conversion into
+     *  `map`. Returns a pointer past the symbol, or `nullptr` if it does not match.
+     *
+     *  Affine conversions, such as Celsius to Kelvin, are only accepted when `Affine` is set,
+     *  which is only the case for a unit that is not part of a `mul` or a `frac`.
+     */
+    template <typename U, bool Affine>
+    struct unit_parser {
+      static constexpr const char*
+      parse(const char* first, const char* last, unit_map& map) noexcept {
+        if constexpr (!is_symbol_token(U::symbol_view())) {
+          constexpr std::string_view symbol = U::symbol_view();
+          if (static_cast<std::size_t>(last - first) >= symbol.size() &&
+              std::string_view{first, symbol.size()} == symbol) {
+            return first + symbol.size();
+          }
+          if constexpr (std::same_as<U, no_unit>) {
+            if (first != last && *first == '1') {
+              return first + 1;
+            }
+          }
+          return nullptr;
+        } else {
+          const char* end = first;
+          while (end != last && !is_symbol_delimiter(*end)) {
+            ++end;
+          }
+
+          const auto* entry =
+            symbol_table<U>::find({first, static_cast<std::size_t>(end - first)});
+          if (entry == nullptr || (!Affine && entry->map.offset.num != 0)) {
+            return nullptr;
+          }
+          if (map.offset.num != 0) [[unlikely]] {
+            map.offset = map.offset * entry->map.scale + entry->map.offset;
+          } else {
+            map.offset = entry->map.offset;
+          }
+          map.scale_by(entry->map.scale);
+          return end;
+        }
+      }
+    };
+
+    template <typename... Ps, bool Affine>
+    struct unit_parser<mul<Ps...>, Affine> {
+      static constexpr const char*
+      parse(const char* first, const char* last, unit_map& map) noexcept {
+        const char* it           = first;
+        bool        first_factor = true;
+
+        const bool matched = ([&] {
+          if (!std::exchange(first_factor, false)) {
+            if (it == last || *it != '*') {
+              return false;
+            }
+            ++it;
+          }
+          it = unit_parser<Ps, false>::parse(it, last, map);
+          return it != nullptr;
+        }() && ...);
+
+        return matched ? it : nullptr;
+      }
+    };
+
+    template <typename N, typename D, bool Affine>
+    struct unit_parser<frac<N, D>, Affine> {
+      //! Parses `(Part)`, or `Part` without parentheses
+      template <typename Part>
+      static constexpr const char*
+      parse_operand(const char* first, const char* last, unit_map& map) noexcept {
+        if (first != last && *first == '(') {
+          unit_map    inner{};
+          const char* it = unit_parser<Part, false>::parse(first + 1, last, inner);
+          if (it != nullptr && it != last && *it == ')') {
+            map.scale_by(inner.scale);
+            return it + 1;
+          }
+        }
+        return unit_parser<Part, false>::parse(first, last, map);
+      }
+
+      static constexpr const char*
+      parse(const char* first, const char* last, unit_map& map) noexcept {
+        unit_map    numerator{};
+        unit_map    denominator{};
+        const char* it = parse_operand<N>(first, last, numerator);
+        if (it == nullptr || it == last || *it != '/') {
+          return nullptr;
+        }
+        it = parse_operand<D>(it + 1, last, denominator);
+        if (it == nullptr) {
+          return nullptr;
+        }
+        map.scale_by(numerator.scale);
+        map.scale_by({denominator.scale.den, denominator.scale.num, denominator.scale.overflow});
+        return it;
+      }
+    };
+
+    //! `ratio` rounded once to `T`, with a single division when both its terms are exact in `T`
+    template <typename T>
+    constexpr T coefficient(const exact_ratio& ratio) noexcept {
+      constexpr exact_int exact_limit = exact_int{1} << std::numeric_limits<T>::digits;
+      if (exact_ratio::abs(ratio.num) <= exact_limit && ratio.den <= exact_limit) [[likely]] {
+        return static_cast<T>(ratio.num) / static_cast<T>(ratio.den);
+      }
+      return ratio.template as<T>();
+    }
+
+    /*! Converts `value` with `map`. Floating point values are scaled by the coefficients of
+     *  the map, each rounded once. Integral values are converted exactly and truncated toward
+     *  zero, like @ref quantify::quantity::as() does; `std::errc::result_out_of_range` is
+     *  returned if the result does not fit in `T`.
+     */
+    template <typename T>
+    constexpr std::errc apply_unit_map(T& value, const unit_map& map) noexcept {
+      if (map.identity()) {
+        return std::errc{};
+      }
+      if (map.scale.overflow || map.offset.overflow) [[unlikely]] {
+        return std::errc::result_out_of_range;
+      }
+      if constexpr (std::is_floating_point_v<T>) {
+        using compute_t = std::conditional_t<(sizeof(T) > sizeof(double)), T, double>;
+        const auto x    = static_cast<compute_t>(value);
+        compute_t  result{};
+        if (map.scale.den == 1) {
+          result = x * static_cast<compute_t>(map.scale.num);
+        } else if (map.scale.num == 1) {
+          result = x / static_cast<compute_t>(map.scale.den);
+        } else {
+          result = x * coefficient<compute_t>(map.scale);
+        }
+        if (map.offset.num != 0) {
+          result += coefficient<compute_t>(map.offset);
+        }
+        value = static_cast<T>(result);
+      } else {
+        // (value * scale.num * offset.den + offset.num * scale.den) / (scale.den * offset.den)
+        exact_int numerator{}, addend{}, denominator{};
+        if (__builtin_mul_overflow(static_cast<exact_int>(value), map.scale.num, &numerator) ||
+            __builtin_mul_overflow(numerator, map.offset.den, &numerator) ||
+            __builtin_mul_overflow(map.offset.num, map.scale.den, &addend) ||
+            __builtin_add_overflow(numerator, addend, &numerator) ||
+            __builtin_mul_overflow(map.scale.den, map.offset.den, &denominator)) [[unlikely]] {
+          return std::errc::result_out_of_range;
+        }
+        const exact_int result = numerator / denominator;
+        if (!fits_in<T>(result)) {
+          return std::errc::result_out_of_range;
+        }
+        value = static_cast<T>(result);
+      }
+      return std::errc{};
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Parses a quantity of unit `U` from the beginning of `[first, last)`
+   *
+   * Mirrors `std::from_chars`: the number is read with `std::from_chars`, optionally followed
+   * by spaces and then by the unit symbol. The parsed value is converted into `U`.
+   *
+   * ```c++
+   * Q<frac<meter, seconds>> speed;
+   * auto [ptr, ec] = quantify::from_chars(text.begin(), text.end(), speed); // "36 km/hours"
+   * // speed.value == 10.0
+   * ```
+   *
+   * Units inside a `mul` or a `frac` must belong to the same scale as the corresponding unit
+   * of `U`. A unit on its own may also be in a scale convertible to that of `U`, such as
+   * Celsius for Kelvin. The conversion is composed exactly from the parsed symbols. Integral
+   * quantities are converted exactly and truncated toward zero, like
+   * @ref quantify::quantity::as() does.
+   *
+   * @param first Beginning of the text
+   * @param last End of the text
+   * @param out Quantity to store the parsed value in, only modified on success
+   * @return Pointer past the parsed text and `std::errc{}` on success. On failure, the error is
+   *         `std::errc::invalid_argument` or `std::errc::result_out_of_range` and the pointer is
+   *         `first` or, if the number or its conversion into `U` was out of range, past the
+   *         number.
+   */
+  template <typename U, typename T>
+  std::from_chars_result
+  from_chars(const char* first, const char* last, quantity<U, T>& out) noexcept {
+    T    number{};
+    auto result = std::from_chars(first, last, number);
+    if (result.ec != std::errc{}) {
+      return result;
+    }
+
+    const char* it = result.ptr;
+    while (it != last && (*it == ' ' || *it == '\t')) {
+      ++it;
+    }
+
+    detail::unit_map map{};
+    const char*      end = detail::unit_parser<U, true>::parse(it, last, map);
+    if (end == nullptr) {
+      return {first, std::errc::invalid_argument};
+    }
+
+    if (const auto ec = detail::apply_unit_map(number, map); ec != std::errc{}) {
+      return {result.ptr, ec};
+    }
+    out.value = number;
+    return {end, std::errc{}};
+  }
+
+  /*! @brief Parses `text` as a quantity of unit `U`
+   *
+   * Leading and trailing whitespace is ignored; anything else must be part of the quantity.
+   * See @ref quantify::from_chars for the accepted format.
+   *
+   * ```c++
+   * auto t = quantify::parse<kelvin>("303 K");                     // 303 K
+   * auto c = quantify::parse<celsius>("303 K");                    // 29.85 C
+   * auto v = quantify::parse<frac<meter, seconds>>("36 km/hours"); // 10 (m)/(s)
+   * ```
+   *
+   * @tparam U Unit of the parsed quantity
+   * @tparam T Underlying data type of the parsed quantity
+   */
+  template <typename U, typename T = double>
+  std::expected<quantity<U, T>, std::errc> parse(std::string_view text) noexcept {
+    const auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+    while (!text.empty() && is_space(text.front())) {
+      text.remove_prefix(1);
+    }
+    while (!text.empty() && is_space(text.back())) {
+      text.remove_suffix(1);
+    }
+
+    quantity<U, T> result{};
+    const char*    last  = text.data() + text.size();
+    const auto [ptr, ec] = quantify::from_chars(text.data(), last, result);
+    if (ec != std::errc{}) {
+      return std::unexpected{ec};
+    }
+    if (ptr != last) {
+      return std::unexpected{std::errc::invalid_argument};
+    }
+    return result;
+  }
+} // namespace quantify
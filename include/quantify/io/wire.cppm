@@ -0,0 +1,448 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  wire.cppm
+ *  \brief Binary, columnar encoding of quantities
+ *
+ * A wire stream is a header followed by blocks. Every block holds values of a single unit and
+ * data type, so the unit is checked once per block and the values are stored raw:
+ *
+ *     stream ::= stream_header block*
+ *     block  ::= block_header value[count] padding
+ *
+ * | Field            | Size | Contents                                                |
+ * |------------------|------|---------------------------------------------------------|
+ * | stream `magic`   | 8    | `"QUANTIFY"`                                            |
+ * | stream `version` | 4    | @ref quantify::wire_version                             |
+ * | stream `endian`  | 4    | `0x01020304` in the byte order of the producer          |
+ * | block `unit`     | 8    | @ref quantify::unit_wire_id_v of the unit               |
+ * | block `type`     | 4    | @ref quantify::type_wire_id_v of the data type          |
+ * | block `reserved` | 4    | Zero                                                    |
+ * | block `count`    | 8    | Amount of values in the block                           |
+ * | block `size`     | 8    | Size of the values plus padding, a multiple of 16 bytes |
+ *
+ * Both headers and every payload start at a multiple of 16 bytes from the beginning of the
+ * stream, so a stream mapped in memory can be read as `std::span<const quantity<U, T>>` without
+ * copying anything.
+ */
+
+export module quantify.io:wire;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  //! Version written to, and required from, wire streams
+  constexpr std::uint32_t wire_version = 1;
+
+  //! Alignment of every header and payload in a wire stream
+  constexpr std::size_t wire_alignment = 16;
+
+  //! @cond NEVER
+  namespace detail {
+    //! FNV-1a over the components of a unit expression, independent of the compiler
+    struct wire_hasher {
+      std::uint64_t state = 0xcbf29ce484222325ULL;
+
+      constexpr wire_hasher& byte(std::uint8_t b) noexcept {
+        state ^= b;
+        state *= 0x100000001b3ULL;
+        return *this;
+      }
+
+      constexpr wire_hasher& integer(std::uint64_t value) noexcept {
+        for (int i = 0; i < 8; ++i) {
+          byte(static_cast<std::uint8_t>(value >> (8 * i)));
+        }
+        return *this;
+      }
+
+      constexpr wire_hasher& text(std::string_view str) noexcept {
+        for (const char c: str) {
+          byte(static_cast<std::uint8_t>(c));
+        }
+        return integer(str.size());
+      }
+
+      constexpr wire_hasher& ratio(const exact_ratio& r) noexcept {
+        const auto num = static_cast<unsigned __int128>(r.num);
+        const auto den = static_cast<unsigned __int128>(r.den);
+        return integer(static_cast<std::uint64_t>(num))
+          .integer(static_cast<std::uint64_t>(num >> 64))
+          .integer(static_cast<std::uint64_t>(den))
+          .integer(static_cast<std::uint64_t>(den >> 64));
+      }
+    };
+
+    enum class wire_tag : std::uint8_t {
+      unit  = 'U',
+      scale = 'S',
+      mul   = 'M',
+      frac  = 'F',
+      none  = 'N',
+    };
+
+    template <typename S>
+    struct scale_wire_id {
+      static constexpr std::uint64_t value =
+        wire_hasher{}.byte(std::to_underlying(wire_tag::scale)).text(S::symbol_view()).state;
+    };
+
+    template <>
+    struct scale_wire_id<no_scale> {
+      static constexpr std::uint64_t value =
+        wire_hasher{}.byte(std::to_underlying(wire_tag::none)).state;
+    };
+
+    template <typename... Ss>
+    struct scale_wire_id<mul<Ss...>> {
+      static constexpr std::uint64_t value = [] {
+        wire_hasher hasher{};
+        hasher.byte(std::to_underlying(wire_tag::mul)).integer(sizeof...(Ss));
+        (hasher.integer(scale_wire_id<Ss>::value), ...);
+        return hasher.state;
+      }();
+    };
+
+    template <typename N, typename D>
+    struct scale_wire_id<frac<N, D>> {
+      static constexpr std::uint64_t value =
+        wire_hasher{}
+          .byte(std::to_underlying(wire_tag::frac))
+          .integer(scale_wire_id<N>::value)
+          .integer(scale_wire_id<D>::value)
+          .state;
+    };
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Stable 64-bit identifier of unit `U` in wire streams
+   *
+   * Derived from the structure of the unit expression: leaf units hash their symbol, their
+   * scale and their factor, while `mul` and `frac` hash the identifiers of their operands in
+   * order. The identifier is therefore the same across compilers and builds, and changes if a
+   * unit is redefined with a different factor.
+   *
+   * @tparam U Unit
+   */
+  template <typename U>
+  struct unit_wire_id {
+    static constexpr std::uint64_t value =
+      detail::wire_hasher{}
+        .byte(std::to_underlying(detail::wire_tag::unit))
+        .text(U::symbol_view())
+        .integer(detail::scale_wire_id<typename U::scale>::value)
+        .ratio(unit_factor_v<U>)
+        .state;
+  };
+
+  template <typename... Ps>
+  struct unit_wire_id<mul<Ps...>> {
+    static constexpr std::uint64_t value = [] {
+      detail::wire_hasher hasher{};
+      hasher.byte(std::to_underlying(detail::wire_tag::mul)).integer(sizeof...(Ps));
+      (hasher.integer(unit_wire_id<Ps>::value), ...);
+      return hasher.state;
+    }();
+  };
+
+  template <typename N, typename D>
+  struct unit_wire_id<frac<N, D>> {
+    static constexpr std::uint64_t value =
+      detail::wire_hasher{}
+        .byte(std::to_underlying(detail::wire_tag::frac))
+        .integer(unit_wire_id<N>::value)
+        .integer(unit_wire_id<D>::value)
+        .state;
+  };
+
+  //! See @ref quantify::unit_wire_id
+  template <typename U>
+  constexpr std::uint64_t unit_wire_id_v = unit_wire_id<U>::value;
+
+  /*! @brief Identifier of arithmetic type `T` in wire streams
+   *
+   * The kind of type (signed, unsigned or floating point) in the high byte and its size in
+   * bytes in the low byte.
+   */
+  template <typename T>
+    requires std::is_arithmetic_v<T>
+  constexpr std::uint32_t type_wire_id_v =
+    (std::is_floating_point_v<T> ? 3u : std::is_signed_v<T> ? 1u : 2u) << 8 | sizeof(T);
+
+  //! Header at the start of every wire stream
+  struct wire_stream_header {
+    char          magic[8] = {'Q', 'U', 'A', 'N', 'T', 'I', 'F', 'Y'};
+    std::uint32_t version  = wire_version;
+    std::uint32_t endian   = 0x01020304;
+  };
+
+  //! Header at the start of every block
+  struct wire_block_header {
+    std::uint64_t unit     = 0;
+    std::uint32_t type     = 0;
+    std::uint32_t reserved = 0;
+    std::uint64_t count    = 0;
+    std::uint64_t size     = 0;
+  };
+
+  static_assert(sizeof(wire_stream_header) % wire_alignment == 0);
+  static_assert(sizeof(wire_block_header) % wire_alignment == 0);
+
+  /*! @brief View of one block of a wire stream
+   *
+   * Only valid as long as the bytes it was read from.
+   */
+  struct wire_block {
+    wire_block_header          header{};
+    std::span<const std::byte> payload{};
+
+    //! Whether this block holds values of unit `U` in data type `T`
+    template <typename U, typename T>
+    [[nodiscard]]
+    constexpr bool holds() const noexcept {
+      return header.unit == unit_wire_id_v<U> && header.type == type_wire_id_v<T>;
+    }
+
+    /*! @brief Views the values of this block as quantities of unit `U`, without copying
+     *
+     * @return The values, or `std::errc::invalid_argument` if the block holds another unit or
+     *         data type.
+     */
+    template <typename U, typename T>
+      requires std::is_arithmetic_v<T> && is_layout_transparent_v<U, T>
+    [[nodiscard]]
+    std::expected<std::span<const quantity<U, T>>, std::errc> as() const noexcept {
+      if (!holds<U, T>()) {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      return std::span<const quantity<U, T>>{
+        reinterpret_cast<const quantity<U, T>*>(payload.data()),
+        static_cast<std::size_t>(header.count),
+      };
+    }
+  };
+
+  /*! @brief Writes quantities to a wire stream
+   *
+   * `Sink` is anything with a `write(const char*, std::streamsize)` member, such as
+   * `std::ostream`. The stream header is written on construction; every call to `write` then
+   * appends one block per `block_size` values, and none for an empty span.
+   *
+   * ```c++
+   * std::ofstream file{"samples.qty", std::ios::binary};
+   * quantify::wire_writer writer{file};
+   * writer.write(std::span{distances});  // std::vector<Q<meter, double>>
+   * writer.write(std::span{durations});  // std::vector<Q<seconds, float>>
+   * ```
+   */
+  template <typename Sink>
+  class wire_writer {
+  public:
+    //! Maximum amount of values in a block
+    std::size_t block_size = std::size_t{1} << 20;
+
+    explicit wire_writer(Sink& sink): sink_(sink) {
+      const wire_stream_header header{};
+      sink_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    template <typename U, typename T>
+      requires std::is_arithmetic_v<T> && is_layout_transparent_v<U, T>
+    void write(std::span<const quantity<U, T>> values) {
+      while (!values.empty()) {
+        const auto chunk = values.first(std::min(values.size(), block_size));
+        write_block(unit_wire_id_v<U>, type_wire_id_v<T>, chunk.size(), std::as_bytes(chunk));
+        values = values.subspan(chunk.size());
+      }
+    }
+
+    template <typename U, typename T>
+      requires std::is_arithmetic_v<T> && is_layout_transparent_v<U, T>
+    void write(std::span<quantity<U, T>> values) {
+      write(std::span<const quantity<U, T>>{values});
+    }
+
+  private:
+    Sink& sink_;
+
+    void write_block(
+      std::uint64_t unit, std::uint32_t type, std::size_t count, std::span<const std::byte> bytes
+    ) {
+      static constexpr char padding[wire_alignment]{};
+
+      const std::size_t size =
+        (bytes.size() + wire_alignment - 1) / wire_alignment * wire_alignment;
+      const wire_block_header header{unit, type, 0, count, size};
+      sink_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+      sink_.write(
+        reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size())
+      );
+      sink_.write(padding, static_cast<std::streamsize>(size - bytes.size()));
+    }
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    inline std::errc check_stream_header(const wire_stream_header& header) noexcept {
+      if (std::string_view{header.magic, 8} != std::string_view{wire_stream_header{}.magic, 8}) {
+        return std::errc::illegal_byte_sequence;
+      }
+      if (header.version != wire_version || header.endian != wire_stream_header{}.endian) {
+        return std::errc::not_supported;
+      }
+      return std::errc{};
+    }
+
+    inline bool valid_block_header(const wire_block_header& header) noexcept {
+      const std::uint32_t value_size = header.type & 0xff;
+      return header.size % wire_alignment == 0 && value_size != 0 &&
+             header.count <= header.size / value_size;
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Reads the blocks of a wire stream held in memory, e.g. a memory-mapped file
+   *
+   * Blocks are views into the given bytes, so values are never copied. The bytes must start at
+   * an address aligned to @ref quantify::wire_alignment, which memory-mapped files always are.
+   */
+  class wire_reader {
+  public:
+    /*! @brief Validates the stream header of `bytes`
+     *
+     * @return A reader positioned at the first block, `std::errc::illegal_byte_sequence` if
+     *         `bytes` is not a wire stream, `std::errc::not_supported` if it was written with
+     *         another version or endianness, or `std::errc::invalid_argument` if `bytes` is
+     *         not aligned.
+     */
+    static std::expected<wire_reader, std::errc> open(std::span<const std::byte> bytes) noexcept {
+      if (reinterpret_cast<std::uintptr_t>(bytes.data()) % wire_alignment != 0) {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      if (bytes.size() < sizeof(wire_stream_header)) {
+        return std::unexpected{std::errc::illegal_byte_sequence};
+      }
+      wire_stream_header header{};
+      std::memcpy(&header, bytes.data(), sizeof(header));
+      if (const auto ec = detail::check_stream_header(header); ec != std::errc{}) {
+        return std::unexpected{ec};
+      }
+      return wire_reader{bytes.subspan(sizeof(header))};
+    }
+
+    //! Whether every block has been read
+    [[nodiscard]]
+    bool done() const noexcept {
+      return remaining_.empty();
+    }
+
+    /*! @brief Reads the next block
+     *
+     * @return The block, or `std::errc::illegal_byte_sequence` if the stream is truncated or
+     *         malformed, in which case the reader is left at its end.
+     */
+    std::expected<wire_block, std::errc> next() noexcept {
+      wire_block block{};
+      if (remaining_.size() < sizeof(wire_block_header)) {
+        remaining_ = {};
+        return std::unexpected{std::errc::illegal_byte_sequence};
+      }
+      std::memcpy(&block.header, remaining_.data(), sizeof(block.header));
+      remaining_ = remaining_.subspan(sizeof(block.header));
+      if (!detail::valid_block_header(block.header) || remaining_.size() < block.header.size) {
+        remaining_ = {};
+        return std::unexpected{std::errc::illegal_byte_sequence};
+      }
+      block.payload = remaining_.first(block.header.count * (block.header.type & 0xff));
+      remaining_    = remaining_.subspan(block.header.size);
+      return block;
+    }
+
+  private:
+    std::span<const std::byte> remaining_{};
+
+    explicit wire_reader(std::span<const std::byte> remaining) noexcept: remaining_(remaining) {
+    }
+  };
+
+  /*! @brief Reads the blocks of a wire stream from a `std::istream`
+   *
+   * Each block is read into a buffer owned by the reader, which is reused by the next call to
+   * `next`. The size of a block is only known from its header, so blocks larger than
+   * `max_block_size` are rejected before anything is allocated for them.
+   */
+  class wire_stream_reader {
+  public:
+    //! Largest payload of a block, in bytes, that the reader accepts
+    std::size_t max_block_size = std::size_t{1} << 28;
+
+    /*! @brief Reads and validates the stream header
+     *
+     * @return See @ref quantify::wire_reader::open
+     */
+    static std::expected<wire_stream_reader, std::errc> open(std::istream& in) {
+      wire_stream_header header{};
+      if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        return std::unexpected{std::errc::illegal_byte_sequence};
+      }
+      if (const auto ec = detail::check_stream_header(header); ec != std::errc{}) {
+        return std::unexpected{ec};
+      }
+      return wire_stream_reader{in};
+    }
+
+    //! Whether every block has been read
+    [[nodiscard]]
+    bool done() const {
+      return in_->peek() == std::istream::traits_type::eof();
+    }
+
+    /*! @brief Reads the next block
+     *
+     * @return The block, valid until the next call, `std::errc::illegal_byte_sequence` if
+     *         the stream is truncated or malformed, or `std::errc::value_too_large` if the block
+     *         is larger than `max_block_size`.
+     */
+    std::expected<wire_block, std::errc> next() {
+      wire_block block{};
+      if (!in_->read(reinterpret_cast<char*>(&block.header), sizeof(block.header)) ||
+          !detail::valid_block_header(block.header)) {
+        return std::unexpected{std::errc::illegal_byte_sequence};
+      }
+      if (block.header.size > max_block_size) {
+        return std::unexpected{std::errc::value_too_large};
+      }
+      buffer_.resize(block.header.size / sizeof(chunk));
+      auto* data = reinterpret_cast<char*>(buffer_.data());
+      if (!in_->read(data, static_cast<std::streamsize>(block.header.size))) {
+        return std::unexpected{std::errc::illegal_byte_sequence};
+      }
+      block.payload =
+        std::as_bytes(std::span{buffer_}).first(block.header.count * (block.header.type & 0xff));
+      return block;
+    }
+
+  private:
+    struct alignas(wire_alignment) chunk {
+      std::byte bytes[wire_alignment];
+    };
+
+    std::istream*      in_;
+    std::vector<chunk> buffer_{};
+
+    explicit wire_stream_reader(std::istream& in): in_(&in) {
+    }
+  };
+} // namespace quantify
@@ -0,0 +1,420 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  lazy.cppm
+ *  \brief Lazy quantity expressions that fuse mixed-unit arithmetic into a single evaluation
+ *
+ * Wrapping a quantity, or a contiguous range of quantities, with @ref quantify::lazy::of makes
+ * the arithmetic operators build a typed expression tree instead of a quantity. The unit of
+ * every node is resolved through `reduce` exactly as the eager operators do, but the values are
+ * combined raw: every conversion factor that a product or a quotient would apply is folded into
+ * a single exact factor at compile-time, which is applied once when the expression is
+ * evaluated, together with the conversion into the requested unit. Sums still rescale one of
+ * their operands, by a single constant.
+ *
+ * Expressions over ranges are evaluated element-wise into an output range by a single loop,
+ * without intermediate buffers. Scalars and single quantities in the same expression are
+ * broadcast to every element.
+ *
+ * Only floating point data types are supported, since deferring the factors would change where
+ * integral values are truncated.
+ */
+
+export module quantify.lazy;
+import std;
+import quantify.core;
+
+export namespace quantify::lazy {
+  /*! @brief Leaf of an expression holding the value of a single quantity
+   */
+  template <typename U, std::floating_point T>
+  struct value_leaf {
+    using quantity_expression = void;
+    using unit                = U;
+    using data_type           = T;
+
+    static constexpr exact_ratio factor{};
+    static constexpr bool        is_range = false;
+
+    T value{};
+
+    [[nodiscard]]
+    constexpr T raw(std::size_t) const noexcept {
+      return value;
+    }
+  };
+
+  /*! @brief Leaf of an expression viewing a contiguous range of quantities
+   */
+  template <typename U, std::floating_point T>
+  struct range_leaf {
+    using quantity_expression = void;
+    using unit                = U;
+    using data_type           = T;
+
+    static constexpr exact_ratio factor{};
+    static constexpr bool        is_range = true;
+
+    std::span<const quantity<U, T>> values{};
+
+    [[nodiscard]]
+    constexpr std::size_t size() const noexcept {
+      return values.size();
+    }
+
+    [[nodiscard]]
+    constexpr bool has_size(std::size_t n) const noexcept {
+      return values.size() == n;
+    }
+
+    [[nodiscard]]
+    constexpr T raw(std::size_t i) const noexcept {
+      return values[i].value;
+    }
+  };
+
+  /*! @brief Predicate that checks if a type is a node of a lazy quantity expression
+   *
+   * The value of an expression in its `unit` is `raw(i) * factor`, where `i` is ignored unless
+   * the expression is a range.
+   */
+  template <typename E>
+  concept Expression = requires(const E& e, std::size_t i) {
+    typename E::quantity_expression;
+    typename E::unit;
+    typename E::data_type;
+    { E::factor } -> std::convertible_to<exact_ratio>;
+    { E::is_range } -> std::convertible_to<bool>;
+    { e.raw(i) } -> std::same_as<typename E::data_type>;
+  };
+
+  //! @cond NEVER
+  namespace detail {
+    //! Scalar operand of an expression
+    template <std::floating_point T>
+    struct scalar {
+      using data_type = T;
+
+      static constexpr bool is_range = false;
+
+      T value{};
+
+      [[nodiscard]]
+      constexpr T raw(std::size_t) const noexcept {
+        return value;
+      }
+    };
+
+    template <typename X>
+    constexpr exact_ratio factor_of = exact_ratio{};
+
+    template <Expression X>
+    constexpr exact_ratio factor_of<X> = X::factor;
+
+    //! Factor that converts the right-hand side into the unit of the left-hand side, as the
+    //! eager operators do for units of the same scale
+    template <typename L, typename R>
+    constexpr exact_ratio rhs_conversion = [] {
+      if constexpr (Expression<L> && Expression<R>) {
+        if constexpr (SameScale<typename L::unit, typename R::unit>) {
+          return conversion_factor_v<typename R::unit, reduce<typename L::unit>>;
+        }
+      }
+      return exact_ratio{};
+    }();
+
+    struct multiplies {
+      template <typename L, typename R>
+      static consteval auto unit() noexcept {
+        if constexpr (!Expression<L>) {
+          return std::type_identity<reduce<typename R::unit>>{};
+        } else if constexpr (!Expression<R>) {
+          return std::type_identity<reduce<typename L::unit>>{};
+        } else if constexpr (SameScale<typename L::unit, typename R::unit>) {
+          using UL = reduce<typename L::unit>;
+          return std::type_identity<reduce<mul<UL, UL>>>{};
+        } else {
+          using UL = reduce<typename L::unit>;
+          using UR = reduce<typename R::unit>;
+          return std::type_identity<reduce<mul<UL, UR>>>{};
+        }
+      }
+
+      template <typename L, typename R>
+      static constexpr exact_ratio factor = factor_of<L> * factor_of<R> * rhs_conversion<L, R>;
+
+      template <typename L, typename R, typename T>
+      static constexpr T apply(T lhs, T rhs) noexcept {
+        return lhs * rhs;
+      }
+    };
+
+    struct divides {
+      template <typename L, typename R>
+      static consteval auto unit() noexcept {
+        if constexpr (!Expression<L>) {
+          return std::type_identity<reduce<frac<no_unit, reduce<typename R::unit>>>>{};
+        } else if constexpr (!Expression<R>) {
+          return std::type_identity<reduce<typename L::unit>>{};
+        } else if constexpr (SameScale<typename L::unit, typename R::unit>) {
+          using UL = reduce<typename L::unit>;
+          return std::type_identity<reduce<frac<UL, UL>>>{};
+        } else {
+          using UL = reduce<typename L::unit>;
+          using UR = reduce<typename R::unit>;
+          return std::type_identity<reduce<frac<UL, UR>>>{};
+        }
+      }
+
+      template <typename L, typename R>
+      static constexpr exact_ratio factor =
+        factor_of<L> / (factor_of<R> * rhs_conversion<L, R>);
+
+      template <typename L, typename R, typename T>
+      static constexpr T apply(T lhs, T rhs) noexcept {
+        return lhs / rhs;
+      }
+    };
+
+    //! Sums keep the factor of their left-hand side and rescale their right-hand side into it
+    template <bool Subtract>
+    struct adds {
+      template <typename L, typename R>
+      static consteval auto unit() noexcept {
+        static_assert(
+          SameScale<typename L::unit, typename R::unit>,
+          "Only quantities of the same scale can be added or subtracted."
+        );
+        return std::type_identity<reduce<typename L::unit>>{};
+      }
+
+      template <typename L, typename R>
+      static constexpr exact_ratio factor = L::factor;
+
+      template <typename L, typename R, typename T>
+      static constexpr T apply(T lhs, T rhs) noexcept {
+        constexpr exact_ratio rescale = R::factor * rhs_conversion<L, R> / L::factor;
+        if constexpr (Subtract) {
+          return lhs - apply_factor<rescale>(rhs);
+        } else {
+          return lhs + apply_factor<rescale>(rhs);
+        }
+      }
+    };
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Inner node of a lazy quantity expression
+   *
+   * @tparam Op Operation
+   * @tparam L Left-hand side operand
+   * @tparam R Right-hand side operand
+   */
+  template <typename Op, typename L, typename R>
+  struct node {
+    using quantity_expression = void;
+    using unit                = typename decltype(Op::template unit<L, R>())::type;
+    using data_type           = typename L::data_type;
+
+    static constexpr exact_ratio factor   = Op::template factor<L, R>;
+    static constexpr bool        is_range = L::is_range || R::is_range;
+
+    static_assert(
+      !factor.overflow, "The factor of this expression cannot be represented exactly in 128 bits."
+    );
+
+    L lhs{};
+    R rhs{};
+
+    [[nodiscard]]
+    constexpr data_type raw(std::size_t i) const noexcept {
+      return Op::template apply<L, R>(lhs.raw(i), rhs.raw(i));
+    }
+
+    //! Number of elements of the first range in the expression, see @ref has_size
+    [[nodiscard]]
+    constexpr std::size_t size() const noexcept
+      requires is_range
+    {
+      if constexpr (L::is_range) {
+        return lhs.size();
+      } else {
+        return rhs.size();
+      }
+    }
+
+    //! Whether every range in the expression has `n` elements
+    [[nodiscard]]
+    constexpr bool has_size(std::size_t n) const noexcept
+      requires is_range
+    {
+      if constexpr (L::is_range && R::is_range) {
+        return lhs.has_size(n) && rhs.has_size(n);
+      } else if constexpr (L::is_range) {
+        return lhs.has_size(n);
+      } else {
+        return rhs.has_size(n);
+      }
+    }
+
+    //! Evaluates the expression in its own unit
+    [[nodiscard]]
+    constexpr quantity<unit, data_type> eval() const noexcept
+      requires(!is_range)
+    {
+      return {apply_factor<factor>(raw(0))};
+    }
+
+    //! Evaluates the expression in unit `U`, with a single multiplication
+    template <typename U>
+      requires(!is_range && SameScale<unit, U>)
+    [[nodiscard]]
+    constexpr quantity<U, data_type> as() const noexcept {
+      return {apply_factor<factor * conversion_factor_v<unit, U>>(raw(0))};
+    }
+
+    template <typename U>
+      requires(!is_range && SameScale<unit, U>)
+    constexpr operator quantity<U, data_type>() const noexcept {
+      return as<U>();
+    }
+
+    /*! @brief Evaluates the expression element-wise into `out`
+     *
+     * A single loop computes every element from the operands, applying one factor per element
+     * for the whole expression. Every range in the expression must have as many elements as
+     * `out`, otherwise nothing is written and `std::errc::invalid_argument` is returned.
+     *
+     * @param out Contiguous range of quantities of a unit in the same scale as the expression
+     */
+    template <std::ranges::contiguous_range Out>
+      requires is_range && QuantityConcept<std::ranges::range_value_t<Out>> &&
+               SameScale<unit, typename std::ranges::range_value_t<Out>::unit> &&
+               std::same_as<data_type, typename std::ranges::range_value_t<Out>::data_type>
+    [[nodiscard]]
+    constexpr std::expected<void, std::errc> eval_into(Out&& out) const noexcept {
+      using U                = typename std::ranges::range_value_t<Out>::unit;
+      constexpr exact_ratio f = factor * conversion_factor_v<unit, U>;
+
+      auto*             dst = std::ranges::data(out);
+      const std::size_t n   = std::ranges::size(out);
+      if (!has_size(n)) [[unlikely]] {
+        return std::unexpected{std::errc::invalid_argument};
+      }
+      for (std::size_t i = 0; i < n; ++i) {
+        dst[i].value = apply_factor<f>(raw(i));
+      }
+      return {};
+    }
+  };
+
+  /*! @brief Starts a lazy expression from a single quantity
+   */
+  template <typename U, std::floating_point T>
+  [[nodiscard]]
+  constexpr value_leaf<U, T> of(const quantity<U, T>& q) noexcept {
+    return {q.value};
+  }
+
+  /*! @brief Starts a lazy expression from a contiguous range of quantities
+   *
+   * The expression views the range, which must outlive it.
+   */
+  template <std::ranges::contiguous_range R>
+    requires QuantityConcept<std::ranges::range_value_t<R>> &&
+             std::floating_point<typename std::ranges::range_value_t<R>::data_type>
+  [[nodiscard]]
+  constexpr auto of(const R& range) noexcept {
+    using Q = std::ranges::range_value_t<R>;
+    return range_leaf<typename Q::unit, typename Q::data_type>{
+      std::span<const Q>{std::ranges::data(range), std::ranges::size(range)}
+    };
+  }
+
+  //! @cond NEVER
+  namespace detail {
+    template <typename X>
+    concept Operand = Expression<X> || QuantityConcept<X> || std::is_arithmetic_v<X>;
+
+    template <typename L, typename R>
+    concept Operands = Operand<L> && Operand<R> && (Expression<L> || Expression<R>);
+
+    template <typename X>
+    struct data_type_of {
+      using type = void;
+    };
+
+    template <typename X>
+      requires(Expression<X> || QuantityConcept<X>)
+    struct data_type_of<X> {
+      using type = typename X::data_type;
+    };
+
+    template <typename T, typename X>
+    constexpr auto operand(const X& x) noexcept {
+      if constexpr (Expression<X>) {
+        return x;
+      } else if constexpr (QuantityConcept<X>) {
+        return of(x);
+      } else {
+        return scalar<T>{static_cast<T>(x)};
+      }
+    }
+
+    template <typename Op, typename L, typename R>
+    constexpr auto make_node(const L& lhs, const R& rhs) noexcept {
+      using TL = typename data_type_of<L>::type;
+      using TR = typename data_type_of<R>::type;
+      using T  = std::conditional_t<std::is_void_v<TL>, TR, TL>;
+      static_assert(
+        std::is_void_v<TL> || std::is_void_v<TR> || std::same_as<TL, TR>,
+        "Both operands of a lazy expression must have the same data type."
+      );
+
+      using LN = decltype(operand<T>(lhs));
+      using RN = decltype(operand<T>(rhs));
+      return node<Op, LN, RN>{operand<T>(lhs), operand<T>(rhs)};
+    }
+  } // namespace detail
+  //! @endcond
+
+  template <typename L, typename R>
+    requires detail::Operands<L, R>
+  [[nodiscard]]
+  constexpr auto operator*(const L& lhs, const R& rhs) noexcept {
+    return detail::make_node<detail::multiplies>(lhs, rhs);
+  }
+
+  template <typename L, typename R>
+    requires detail::Operands<L, R>
+  [[nodiscard]]
+  constexpr auto operator/(const L& lhs, const R& rhs) noexcept {
+    return detail::make_node<detail::divides>(lhs, rhs);
+  }
+
+  template <typename L, typename R>
+    requires detail::Operands<L, R> && (!std::is_arithmetic_v<L>) && (!std::is_arithmetic_v<R>)
+  [[nodiscard]]
+  constexpr auto operator+(const L& lhs, const R& rhs) noexcept {
+    return detail::make_node<detail::adds<false>>(lhs, rhs);
+  }
+
+  template <typename L, typename R>
+    requires detail::Operands<L, R> && (!std::is_arithmetic_v<L>) && (!std::is_arithmetic_v<R>)
+  [[nodiscard]]
+  constexpr auto operator-(const L& lhs, const R& rhs) noexcept {
+    return detail::make_node<detail::adds<true>>(lhs, rhs);
+  }
+} // namespace quantify::lazy
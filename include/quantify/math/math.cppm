@@ -0,0 +1,306 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  math.cppm
+ *  \brief Mathematical functions on quantities
+ *
+ * The unit of every result is computed at compile-time from the canonical form of the units of
+ * the arguments, see @ref quantify::canonical. Powers scale the exponents of that form and roots
+ * divide them, after merging the units that belong to the same scale, so `sqrt` of a
+ * `mul<meter, kilometer>` is a `meter`. Whatever rescaling that merge or a mix of units in the
+ * arguments needs is folded into a single constant, applied before calling into `<cmath>`.
+ *
+ * Functions are `constexpr` wherever their `<cmath>` counterpart is.
+ */
+
+export module quantify.math;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  //! @cond NEVER
+  namespace detail {
+    //! `Terms` with every exponent multiplied by `N`
+    template <typename Terms, int N>
+    struct scaled_terms;
+
+    template <typename... Terms, int N>
+    struct scaled_terms<type_list<Terms...>, N> {
+      using type = type_list<term<typename Terms::leaf, Terms::exponent * N>...>;
+    };
+
+    //! `Terms` with every exponent divided by `N`, which must divide all of them
+    template <typename Terms, int N>
+    struct root_terms;
+
+    template <typename... Terms, int N>
+    struct root_terms<type_list<Terms...>, N> {
+      static_assert(
+        ((Terms::exponent % N == 0) && ...),
+        "The exponents of this unit are not multiples of the degree of the root."
+      );
+      using type = type_list<term<typename Terms::leaf, Terms::exponent / N>...>;
+    };
+
+    /*! `Terms` with every leaf replaced by the first leaf of the same scale, and combined, e.g.
+     *  the terms of `mul<meter, kilometer>` become those of `mul<meter, meter>`
+     */
+    template <typename Terms>
+    struct merged_terms;
+
+    template <>
+    struct merged_terms<type_list<>> {
+      using type = type_list<>;
+    };
+
+    template <typename... Terms>
+    struct merged_terms<type_list<Terms...>> {
+    private:
+      template <typename Leaf>
+      static consteval std::size_t first_of_scale() {
+        constexpr bool same[] = {
+          same_dimensions_v<typename Leaf::scale, typename Terms::leaf::scale>...
+        };
+        for (std::size_t i = 0; i < sizeof...(Terms); ++i) {
+          if (same[i]) {
+            return i;
+          }
+        }
+        return sizeof...(Terms);
+      }
+
+      template <typename Leaf>
+      using representative_t =
+        std::tuple_element_t<first_of_scale<Leaf>(), std::tuple<typename Terms::leaf...>>;
+
+    public:
+      using type = typename combine<
+        type_list<term<representative_t<typename Terms::leaf>, Terms::exponent>...>>::type;
+    };
+
+    //! Unit of a quantity in unit `U` raised to the power `N`
+    template <typename U, int N>
+    using power_unit_t = typename emit<typename scaled_terms<
+      typename canonical<U>::terms, N>::type>::type;
+
+    //! Unit `U` with its units of the same scale merged, see @ref merged_terms
+    template <typename U>
+    using merged_unit_t =
+      typename emit<typename merged_terms<typename canonical<U>::terms>::type>::type;
+
+    //! Unit of the `N`-th root of a quantity in unit `U`
+    template <typename U, int N>
+    using root_unit_t = typename emit<typename root_terms<
+      typename merged_terms<typename canonical<U>::terms>::type, N>::type>::type;
+
+    //! `base` raised to the non-negative power `N` by repeated squaring
+    template <unsigned N, typename T>
+    constexpr T unsigned_power(const T& base) noexcept {
+      if constexpr (N == 0) {
+        return T{1};
+      } else if constexpr (N == 1) {
+        return base;
+      } else {
+        const T half = unsigned_power<N / 2>(base);
+        if constexpr (N % 2 == 0) {
+          return half * half;
+        } else {
+          return half * half * base;
+        }
+      }
+    }
+
+    //! Unit that `floor`, `ceil`, `round` and `trunc` round to: `To`, or `U` if none is given
+    template <typename To, typename U>
+    using rounding_unit_t = std::conditional_t<std::is_void_v<To>, U, To>;
+
+    //! `value` of unit `U_FROM` rounded to a multiple of unit `U_TO` according to `Mode`
+    template <typename U_FROM, typename U_TO, rounding Mode, typename T>
+    constexpr T rounded_in_unit(const T& value) noexcept {
+      constexpr exact_ratio F = conversion_factor_v<U_FROM, U_TO>;
+      if constexpr (std::is_integral_v<T>) {
+        return apply_factor<F, Mode>(value);
+      } else {
+        const T scaled = apply_factor<F>(value);
+        if constexpr (Mode == rounding::toward_zero) {
+          return std::trunc(scaled);
+        } else if constexpr (Mode == rounding::to_nearest) {
+          return std::round(scaled);
+        } else if constexpr (Mode == rounding::toward_infinity) {
+          return std::ceil(scaled);
+        } else {
+          return std::floor(scaled);
+        }
+      }
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Raises `q` to the integer power `N`
+   *
+   * The exponents of the unit are multiplied by `N`, so no conversion is ever needed, e.g.
+   * `pow<2>` of a `Q<meter>` is a `Q<mul<meter, meter>>` and `pow<-1>` of a `Q<seconds>` is a
+   * `Q<frac<no_unit, seconds>>`. The value is computed by repeated squaring.
+   */
+  template <int N, typename U, typename T>
+  [[nodiscard]]
+  constexpr quantity<detail::power_unit_t<U, N>, T> pow(const quantity<U, T>& q) noexcept {
+    if constexpr (N >= 0) {
+      return {detail::unsigned_power<static_cast<unsigned>(N)>(q.value)};
+    } else {
+      return {T{1} / detail::unsigned_power<static_cast<unsigned>(-N)>(q.value)};
+    }
+  }
+
+  /*! @brief Square root of `q`
+   *
+   * Units of the same scale are merged into the first of them, and every exponent of the result
+   * is half of the merged one, e.g. the square root of a `Q<mul<meter, kilometer>>` is a
+   * `Q<meter>`. The factor of that merge, if any, is applied to the value before the root.
+   */
+  template <typename U, typename T>
+  [[nodiscard]]
+  auto sqrt(const quantity<U, T>& q) noexcept {
+    constexpr exact_ratio F = conversion_factor_v<U, detail::merged_unit_t<U>>;
+    auto                  r = std::sqrt(apply_factor<F>(q.value));
+    return quantity<detail::root_unit_t<U, 2>, decltype(r)>{r};
+  }
+
+  //! Cube root of `q`, see @ref quantify::sqrt
+  template <typename U, typename T>
+  [[nodiscard]]
+  auto cbrt(const quantity<U, T>& q) noexcept {
+    constexpr exact_ratio F = conversion_factor_v<U, detail::merged_unit_t<U>>;
+    auto                  r = std::cbrt(apply_factor<F>(q.value));
+    return quantity<detail::root_unit_t<U, 3>, decltype(r)>{r};
+  }
+
+  /*! @brief `sqrt(x² + y²)` without intermediate overflow or underflow
+   *
+   * Both quantities must belong to the same scale. The result is in the unit of `x`, and `y` is
+   * converted into it by a single constant factor.
+   */
+  template <typename U1, typename U2, typename T>
+    requires SameScale<U1, U2>
+  [[nodiscard]]
+  quantity<reduce<U1>, T> hypot(const quantity<U1, T>& x, const quantity<U2, T>& y) noexcept {
+    record_conversion<U2, reduce<U1>, conversion_site::arithmetic>();
+    return {std::hypot(x.value, apply_factor<conversion_factor_v<U2, reduce<U1>>>(y.value))};
+  }
+
+  //! `sqrt(x² + y² + z²)`, see @ref quantify::hypot
+  template <typename U1, typename U2, typename U3, typename T>
+    requires SameScale<U1, U2> && SameScale<U1, U3>
+  [[nodiscard]]
+  quantity<reduce<U1>, T> hypot(
+    const quantity<U1, T>& x, const quantity<U2, T>& y, const quantity<U3, T>& z
+  ) noexcept {
+    record_conversion<U2, reduce<U1>, conversion_site::arithmetic>();
+    record_conversion<U3, reduce<U1>, conversion_site::arithmetic>();
+    return {std::hypot(
+      x.value,
+      apply_factor<conversion_factor_v<U2, reduce<U1>>>(y.value),
+      apply_factor<conversion_factor_v<U3, reduce<U1>>>(z.value)
+    )};
+  }
+
+  /*! @brief `x * y + z` computed with a single rounding
+   *
+   * The result is in the unit of `x * y`, and `z` must belong to the same scale. `y` and `z` are
+   * converted the way `x * y + z` would convert them, each by a single constant factor.
+   */
+  template <typename U1, typename U2, typename U3, typename T>
+    requires SameScale<detail::product_unit_t<U1, U2, T>, U3>
+  [[nodiscard]]
+  quantity<detail::product_unit_t<U1, U2, T>, T> fma(
+    const quantity<U1, T>& x, const quantity<U2, T>& y, const quantity<U3, T>& z
+  ) noexcept {
+    using product = detail::product_unit_t<U1, U2, T>;
+    if constexpr (SameScale<U1, U2>) {
+      record_conversion<U2, reduce<U1>, conversion_site::arithmetic>();
+    }
+    record_conversion<U3, product, conversion_site::arithmetic>();
+    return {std::fma(
+      x.value,
+      detail::converted_operand<U1, U2>(y.value),
+      apply_factor<conversion_factor_v<U3, product>>(z.value)
+    )};
+  }
+
+  //! Absolute value of `q`, in the same unit
+  template <typename U, typename T>
+  [[nodiscard]]
+  constexpr quantity<U, T> abs(const quantity<U, T>& q) noexcept {
+    if constexpr (std::is_arithmetic_v<T>) {
+      return {std::abs(q.value)};
+    } else {
+      return {q.value < T{} ? -q.value : q.value};
+    }
+  }
+
+  /*! @brief Remainder of `x / y`, with the sign of `x`
+   *
+   * Both quantities must belong to the same scale. The result is in the unit of `x`.
+   */
+  template <typename U1, typename U2, std::floating_point T>
+    requires SameScale<U1, U2>
+  [[nodiscard]]
+  constexpr quantity<reduce<U1>, T>
+  fmod(const quantity<U1, T>& x, const quantity<U2, T>& y) noexcept {
+    record_conversion<U2, reduce<U1>, conversion_site::arithmetic>();
+    return {std::fmod(x.value, apply_factor<conversion_factor_v<U2, reduce<U1>>>(y.value))};
+  }
+
+  /*! @brief Largest whole amount of unit `To` not greater than `q`
+   *
+   * Like `std::chrono::floor`, the conversion into `To` and the rounding happen in one step, so
+   * integral quantities are rounded exactly instead of truncated first. Without `To`, `q` is
+   * rounded to a whole amount of its own unit.
+   */
+  template <typename To = void, typename U, typename T>
+    requires std::is_void_v<To> || SameScale<To, U>
+  [[nodiscard]]
+  constexpr quantity<detail::rounding_unit_t<To, U>, T> floor(const quantity<U, T>& q) noexcept {
+    using target = detail::rounding_unit_t<To, U>;
+    return {detail::rounded_in_unit<U, target, rounding::toward_neg_infinity>(q.value)};
+  }
+
+  //! Smallest whole amount of unit `To` not less than `q`, see @ref quantify::floor
+  template <typename To = void, typename U, typename T>
+    requires std::is_void_v<To> || SameScale<To, U>
+  [[nodiscard]]
+  constexpr quantity<detail::rounding_unit_t<To, U>, T> ceil(const quantity<U, T>& q) noexcept {
+    using target = detail::rounding_unit_t<To, U>;
+    return {detail::rounded_in_unit<U, target, rounding::toward_infinity>(q.value)};
+  }
+
+  //! Nearest whole amount of unit `To`, ties away from zero, see @ref quantify::floor
+  template <typename To = void, typename U, typename T>
+    requires std::is_void_v<To> || SameScale<To, U>
+  [[nodiscard]]
+  constexpr quantity<detail::rounding_unit_t<To, U>, T> round(const quantity<U, T>& q) noexcept {
+    using target = detail::rounding_unit_t<To, U>;
+    return {detail::rounded_in_unit<U, target, rounding::to_nearest>(q.value)};
+  }
+
+  //! Whole amount of unit `To`, rounded toward zero, see @ref quantify::floor
+  template <typename To = void, typename U, typename T>
+    requires std::is_void_v<To> || SameScale<To, U>
+  [[nodiscard]]
+  constexpr quantity<detail::rounding_unit_t<To, U>, T> trunc(const quantity<U, T>& q) noexcept {
+    using target = detail::rounding_unit_t<To, U>;
+    return {detail::rounded_in_unit<U, target, rounding::toward_zero>(q.value)};
+  }
+} // namespace quantify
@@ -23,4 +23,14 @@
 export module quantify;
 
 export import quantify.core;
+export import quantify.representation;
+export import quantify.conversion;
+export import quantify.vec;
+export import quantify.math;
+export import quantify.lazy;
+export import quantify.dynamic;
+export import quantify.format;
 export import quantify.scales;
+export import quantify.algorithms;
+export import quantify.formulas;
+export import quantify.io;
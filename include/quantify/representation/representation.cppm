@@ -0,0 +1,504 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  representation.cppm
+ *  \brief Integer representation policies: fixed-point, saturating and checked integers
+ *
+ * Each policy wraps a built-in integer and can be used as the data type of a `quantity`. Unit
+ * conversions scale the wrapped integer by the exact conversion factor in a wider intermediate
+ * (see @ref quantify::representation_traits), so nothing overflows or truncates before the
+ * final rounding, which each policy selects with a @ref quantify::rounding mode.
+ */
+
+export module quantify.representation;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  //! @cond NEVER
+  namespace detail {
+    //! Integer wide enough to hold the product of two `I`
+    template <typename I>
+    using wide_int_t =
+      std::conditional_t<sizeof(I) <= sizeof(std::int32_t), std::int64_t, exact_int>;
+
+    //! `value * F + O` in a wide intermediate, rounded once according to `R` and not narrowed
+    template <exact_ratio F, exact_ratio O, rounding R, typename I>
+    constexpr auto scale_rounded(I value) noexcept {
+      // value * F + O == (value * num + addend) / den
+      constexpr exact_int den    = F.den / exact_ratio::gcd(F.den, O.den) * O.den;
+      constexpr exact_int num    = F.num * (den / F.den);
+      constexpr exact_int addend = O.num * (den / O.den);
+      static_assert(
+        fits_in<std::int64_t>(num) && fits_in<std::int64_t>(den) &&
+          fits_in<std::int64_t>(addend),
+        "The conversion does not fit in a 64 bit intermediate."
+      );
+      using intermediate = std::conditional_t<
+        std::is_same_v<product_int_t<I, num>, std::int64_t> && fits_in<std::int32_t>(addend),
+        std::int64_t,
+        exact_int>;
+      const intermediate scaled =
+        static_cast<intermediate>(value) * static_cast<intermediate>(num) +
+        static_cast<intermediate>(addend);
+      if constexpr (den == 1) {
+        return scaled;
+      } else {
+        return divide_rounded<R>(scaled, static_cast<intermediate>(den));
+      }
+    }
+
+    //! `value` rounded to an integer according to `R`
+    template <rounding R, typename I, typename F>
+    constexpr I round_to(F value) noexcept {
+      const auto truncated = static_cast<I>(value);
+      const F    remainder = value - static_cast<F>(truncated);
+      if constexpr (R == rounding::toward_zero) {
+        return truncated;
+      } else if constexpr (R == rounding::toward_infinity) {
+        return remainder > F{0} ? truncated + 1 : truncated;
+      } else if constexpr (R == rounding::toward_neg_infinity) {
+        return remainder < F{0} ? truncated - 1 : truncated;
+      } else if (remainder >= F{0.5}) {
+        return truncated + 1;
+      } else if (remainder <= F{-0.5}) {
+        return truncated - 1;
+      } else {
+        return truncated;
+      }
+    }
+
+    //! Whether truncating `value` yields a value in the range of `I`
+    template <typename I, typename F>
+    constexpr bool in_range(F value) noexcept {
+      constexpr F upper = static_cast<F>(std::numeric_limits<I>::max() / 2 + 1) * F{2};
+      return value >= static_cast<F>(std::numeric_limits<I>::lowest()) && value < upper;
+    }
+
+    //! `lhs + rhs` wrapped around into the range of `I`, without overflowing
+    template <typename I>
+    constexpr I wrapping_add(I lhs, I rhs) noexcept {
+      I result{};
+      __builtin_add_overflow(lhs, rhs, &result);
+      return result;
+    }
+
+    //! `lhs - rhs` wrapped around into the range of `I`, without overflowing
+    template <typename I>
+    constexpr I wrapping_sub(I lhs, I rhs) noexcept {
+      I result{};
+      __builtin_sub_overflow(lhs, rhs, &result);
+      return result;
+    }
+
+    //! `lhs * rhs` wrapped around into the range of `I`, without overflowing
+    template <typename I>
+    constexpr I wrapping_mul(I lhs, I rhs) noexcept {
+      I result{};
+      __builtin_mul_overflow(lhs, rhs, &result);
+      return result;
+    }
+
+    //! `value` clamped into the range of `I`
+    template <typename I, typename W>
+    constexpr I saturate(W value) noexcept {
+      if (value > static_cast<W>(std::numeric_limits<I>::max())) {
+        return std::numeric_limits<I>::max();
+      }
+      if (value < static_cast<W>(std::numeric_limits<I>::lowest())) {
+        return std::numeric_limits<I>::lowest();
+      }
+      return static_cast<I>(value);
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Fixed-point number `raw / Scale` stored in a signed integer `I`
+   *
+   * Addition and subtraction are plain integer operations. Multiplication and division go
+   * through an intermediate twice as wide as `I` and are rounded according to `R`, as are
+   * conversions from floating point values and unit conversions. Results that do not fit in `I`
+   * wrap around modulo the range of `I`, like the built-in unsigned arithmetic, instead of
+   * overflowing. Converting a floating point value out of that range, and dividing by zero, are
+   * undefined. Use @ref binary_fixed or @ref decimal_fixed to pick a power of two or of ten as
+   * `Scale`.
+   *
+   * @tparam I Signed integer storing the raw value
+   * @tparam Scale Number of raw units in one unit of value
+   * @tparam R Rounding mode
+   */
+  template <std::signed_integral I, exact_int Scale, rounding R = rounding::to_nearest>
+  struct fixed_point {
+    static_assert(Scale > 0 && detail::fits_in<I>(Scale), "The scale does not fit in this type.");
+
+    using raw_type = I;
+
+    static constexpr exact_int scale = Scale;
+
+    I raw{};
+
+    constexpr fixed_point() noexcept = default;
+
+    template <std::integral J>
+    constexpr fixed_point(J value) noexcept
+        : raw(detail::wrapping_mul(static_cast<I>(value), static_cast<I>(Scale))) {
+    }
+
+    template <std::floating_point F>
+    explicit constexpr fixed_point(F value) noexcept
+        : raw(detail::round_to<R, I>(value * static_cast<F>(Scale))) {
+    }
+
+    [[nodiscard]]
+    static constexpr fixed_point from_raw(I raw_) noexcept {
+      fixed_point result{};
+      result.raw = raw_;
+      return result;
+    }
+
+    template <std::floating_point F>
+    explicit constexpr operator F() const noexcept {
+      return static_cast<F>(raw) / static_cast<F>(Scale);
+    }
+
+    //! Integral part, rounded according to `R`
+    template <std::integral J>
+    explicit constexpr operator J() const noexcept {
+      return static_cast<J>(detail::divide_rounded<R>(raw, static_cast<I>(Scale)));
+    }
+
+    constexpr fixed_point operator-() const noexcept {
+      return from_raw(detail::wrapping_sub(I{0}, raw));
+    }
+
+    friend constexpr fixed_point operator+(fixed_point lhs, fixed_point rhs) noexcept {
+      return from_raw(detail::wrapping_add(lhs.raw, rhs.raw));
+    }
+
+    friend constexpr fixed_point operator-(fixed_point lhs, fixed_point rhs) noexcept {
+      return from_raw(detail::wrapping_sub(lhs.raw, rhs.raw));
+    }
+
+    friend constexpr fixed_point operator*(fixed_point lhs, fixed_point rhs) noexcept {
+      using wide = detail::wide_int_t<I>;
+      return from_raw(static_cast<I>(detail::divide_rounded<R>(
+        static_cast<wide>(lhs.raw) * static_cast<wide>(rhs.raw), static_cast<wide>(Scale)
+      )));
+    }
+
+    friend constexpr fixed_point operator/(fixed_point lhs, fixed_point rhs) noexcept {
+      using wide           = detail::wide_int_t<I>;
+      const wide numerator = static_cast<wide>(lhs.raw) * static_cast<wide>(Scale);
+      const wide divisor   = static_cast<wide>(rhs.raw);
+      return from_raw(static_cast<I>(
+        divisor < 0 ? detail::divide_rounded<R>(-numerator, -divisor)
+                    : detail::divide_rounded<R>(numerator, divisor)
+      ));
+    }
+
+    template <std::integral J>
+    friend constexpr fixed_point operator*(fixed_point lhs, J rhs) noexcept {
+      return from_raw(detail::wrapping_mul(lhs.raw, static_cast<I>(rhs)));
+    }
+
+    template <std::integral J>
+    friend constexpr fixed_point operator*(J lhs, fixed_point rhs) noexcept {
+      return rhs * lhs;
+    }
+
+    template <std::integral J>
+    friend constexpr fixed_point operator/(fixed_point lhs, J rhs) noexcept {
+      using wide         = detail::wide_int_t<I>;
+      const auto divisor = static_cast<wide>(static_cast<I>(rhs));
+      return from_raw(static_cast<I>(
+        divisor < 0 ? detail::divide_rounded<R>(-static_cast<wide>(lhs.raw), -divisor)
+                    : detail::divide_rounded<R>(static_cast<wide>(lhs.raw), divisor)
+      ));
+    }
+
+    constexpr fixed_point& operator+=(fixed_point rhs) noexcept {
+      return *this = *this + rhs;
+    }
+
+    constexpr fixed_point& operator-=(fixed_point rhs) noexcept {
+      return *this = *this - rhs;
+    }
+
+    constexpr fixed_point& operator*=(fixed_point rhs) noexcept {
+      return *this = *this * rhs;
+    }
+
+    constexpr fixed_point& operator/=(fixed_point rhs) noexcept {
+      return *this = *this / rhs;
+    }
+
+    friend constexpr auto operator<=>(fixed_point lhs, fixed_point rhs) noexcept = default;
+  };
+
+  //! Fixed-point number with `Bits` fractional bits
+  template <std::signed_integral I, unsigned Bits, rounding R = rounding::to_nearest>
+  using binary_fixed = fixed_point<I, exact_int{1} << Bits, R>;
+
+  //! @cond NEVER
+  namespace detail {
+    constexpr exact_int pow10(unsigned digits) noexcept {
+      exact_int result = 1;
+      while (digits-- > 0) {
+        result *= 10;
+      }
+      return result;
+    }
+  } // namespace detail
+  //! @endcond
+
+  //! Fixed-point number with `Digits` fractional decimal digits
+  template <std::signed_integral I, unsigned Digits, rounding R = rounding::to_nearest>
+  using decimal_fixed = fixed_point<I, detail::pow10(Digits), R>;
+
+  template <std::signed_integral I, exact_int Scale, rounding R>
+  struct representation_traits<fixed_point<I, Scale, R>> {
+    static constexpr bool is_specialized = true;
+
+    template <exact_ratio F, exact_ratio O = exact_ratio{0, 1}>
+    [[nodiscard]]
+    static constexpr auto scale(const fixed_point<I, Scale, R>& value) noexcept {
+      // The offset is added to the raw value, in raw units
+      constexpr exact_ratio raw_offset = O * exact_ratio{Scale, 1};
+      return fixed_point<I, Scale, R>::from_raw(
+        static_cast<I>(detail::scale_rounded<F, raw_offset, R>(value.raw))
+      );
+    }
+  };
+
+  /*! @brief Integer `I` whose operations clamp to its range instead of overflowing
+   *
+   * Unit conversions are computed exactly in a wider intermediate, rounded according to `R` and
+   * then clamped, so converting a value that does not fit in the target unit yields the largest
+   * or lowest value of `I`.
+   *
+   * @tparam I Integer type
+   * @tparam R Rounding mode of conversions
+   */
+  template <std::integral I, rounding R = rounding::toward_zero>
+  struct saturating {
+    using raw_type = I;
+
+    I value{};
+
+    constexpr saturating() noexcept = default;
+
+    constexpr saturating(I value_) noexcept: value(value_) {
+    }
+
+    template <std::floating_point F>
+    explicit constexpr saturating(F value_) noexcept {
+      if (detail::in_range<I>(value_)) {
+        value = detail::round_to<R, I>(value_);
+      } else {
+        value = value_ > F{0} ? std::numeric_limits<I>::max() : std::numeric_limits<I>::lowest();
+      }
+    }
+
+    explicit constexpr operator I() const noexcept {
+      return value;
+    }
+
+    constexpr saturating operator-() const noexcept {
+      return saturating{} - *this;
+    }
+
+    friend constexpr saturating operator+(saturating lhs, saturating rhs) noexcept {
+      I result{};
+      if (__builtin_add_overflow(lhs.value, rhs.value, &result)) {
+        return rhs.value > 0 ? std::numeric_limits<I>::max() : std::numeric_limits<I>::lowest();
+      }
+      return result;
+    }
+
+    friend constexpr saturating operator-(saturating lhs, saturating rhs) noexcept {
+      I result{};
+      if (__builtin_sub_overflow(lhs.value, rhs.value, &result)) {
+        return rhs.value < 0 ? std::numeric_limits<I>::max() : std::numeric_limits<I>::lowest();
+      }
+      return result;
+    }
+
+    friend constexpr saturating operator*(saturating lhs, saturating rhs) noexcept {
+      I result{};
+      if (__builtin_mul_overflow(lhs.value, rhs.value, &result)) {
+        return (lhs.value < 0) != (rhs.value < 0) ? std::numeric_limits<I>::lowest()
+                                                  : std::numeric_limits<I>::max();
+      }
+      return result;
+    }
+
+    friend constexpr saturating operator/(saturating lhs, saturating rhs) noexcept {
+      if constexpr (std::is_signed_v<I>) {
+        if (lhs.value == std::numeric_limits<I>::lowest() && rhs.value == -1) {
+          return std::numeric_limits<I>::max();
+        }
+      }
+      return static_cast<I>(lhs.value / rhs.value);
+    }
+
+    constexpr saturating& operator+=(saturating rhs) noexcept {
+      return *this = *this + rhs;
+    }
+
+    constexpr saturating& operator-=(saturating rhs) noexcept {
+      return *this = *this - rhs;
+    }
+
+    constexpr saturating& operator*=(saturating rhs) noexcept {
+      return *this = *this * rhs;
+    }
+
+    constexpr saturating& operator/=(saturating rhs) noexcept {
+      return *this = *this / rhs;
+    }
+
+    friend constexpr auto operator<=>(saturating lhs, saturating rhs) noexcept = default;
+  };
+
+  template <std::integral I, rounding R>
+  struct representation_traits<saturating<I, R>> {
+    static constexpr bool is_specialized = true;
+
+    template <exact_ratio F, exact_ratio O = exact_ratio{0, 1}>
+    [[nodiscard]]
+    static constexpr saturating<I, R> scale(const saturating<I, R>& value) noexcept {
+      return detail::saturate<I>(detail::scale_rounded<F, O, R>(value.value));
+    }
+  };
+
+  /*! @brief Integer `I` that records whether any operation that produced it overflowed
+   *
+   * The overflow flag is sticky: it propagates through every later operation, like a NaN, so a
+   * whole computation can be checked once at the end with @ref get(). Comparisons only look at
+   * the stored values.
+   *
+   * @tparam I Integer type
+   * @tparam R Rounding mode of conversions
+   */
+  template <std::integral I, rounding R = rounding::toward_zero>
+  struct checked {
+    using raw_type = I;
+
+    I    value{};
+    bool overflow = false;
+
+    constexpr checked() noexcept = default;
+
+    constexpr checked(I value_) noexcept: value(value_) {
+    }
+
+    template <std::floating_point F>
+    explicit constexpr checked(F value_) noexcept: overflow(!detail::in_range<I>(value_)) {
+      if (!overflow) {
+        value = detail::round_to<R, I>(value_);
+      }
+    }
+
+    [[nodiscard]]
+    constexpr bool valid() const noexcept {
+      return !overflow;
+    }
+
+    //! Stored value, or `std::errc::value_too_large` if any operation overflowed
+    [[nodiscard]]
+    constexpr std::expected<I, std::errc> get() const noexcept {
+      if (overflow) {
+        return std::unexpected(std::errc::value_too_large);
+      }
+      return value;
+    }
+
+    constexpr checked operator-() const noexcept {
+      return checked{} - *this;
+    }
+
+    friend constexpr checked operator+(checked lhs, checked rhs) noexcept {
+      checked result{};
+      result.overflow = __builtin_add_overflow(lhs.value, rhs.value, &result.value) ||
+                        lhs.overflow || rhs.overflow;
+      return result;
+    }
+
+    friend constexpr checked operator-(checked lhs, checked rhs) noexcept {
+      checked result{};
+      result.overflow = __builtin_sub_overflow(lhs.value, rhs.value, &result.value) ||
+                        lhs.overflow || rhs.overflow;
+      return result;
+    }
+
+    friend constexpr checked operator*(checked lhs, checked rhs) noexcept {
+      checked result{};
+      result.overflow = __builtin_mul_overflow(lhs.value, rhs.value, &result.value) ||
+                        lhs.overflow || rhs.overflow;
+      return result;
+    }
+
+    friend constexpr checked operator/(checked lhs, checked rhs) noexcept {
+      checked result{};
+      result.overflow = lhs.overflow || rhs.overflow || rhs.value == 0;
+      if constexpr (std::is_signed_v<I>) {
+        result.overflow = result.overflow ||
+                          (lhs.value == std::numeric_limits<I>::lowest() && rhs.value == -1);
+      }
+      if (rhs.value != 0 && !result.overflow) {
+        result.value = static_cast<I>(lhs.value / rhs.value);
+      }
+      return result;
+    }
+
+    constexpr checked& operator+=(checked rhs) noexcept {
+      return *this = *this + rhs;
+    }
+
+    constexpr checked& operator-=(checked rhs) noexcept {
+      return *this = *this - rhs;
+    }
+
+    constexpr checked& operator*=(checked rhs) noexcept {
+      return *this = *this * rhs;
+    }
+
+    constexpr checked& operator/=(checked rhs) noexcept {
+      return *this = *this / rhs;
+    }
+
+    friend constexpr auto operator<=>(checked lhs, checked rhs) noexcept {
+      return lhs.value <=> rhs.value;
+    }
+
+    friend constexpr bool operator==(checked lhs, checked rhs) noexcept {
+      return lhs.value == rhs.value;
+    }
+  };
+
+  template <std::integral I, rounding R>
+  struct representation_traits<checked<I, R>> {
+    static constexpr bool is_specialized = true;
+
+    template <exact_ratio F, exact_ratio O = exact_ratio{0, 1}>
+    [[nodiscard]]
+    static constexpr checked<I, R> scale(const checked<I, R>& value) noexcept {
+      const auto scaled = detail::scale_rounded<F, O, R>(value.value);
+      checked<I, R> result{static_cast<I>(scaled)};
+      result.overflow = value.overflow || !detail::fits_in<I>(static_cast<exact_int>(scaled));
+      return result;
+    }
+  };
+} // namespace quantify
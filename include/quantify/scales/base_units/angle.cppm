@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:angle;
+export module quantify.scales.angle;
 import quantify.core;
 
 export namespace quantify {
@@ -24,6 +24,10 @@ export namespace quantify {
   SCALE(angle) {
     UNIT(degrees, "deg", 1, 1);
     UNIT(radians, "rad", 180 * 10000000000000000, 31415926535893238);
+
+    SCALE_UNITS(degrees, radians);
   }
+
+  BASE_DIMENSION(angle::scale, 7);
   //! @}
 } // namespace quantify
@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:distance;
+export module quantify.scales.distance;
 import quantify.core;
 
 export namespace quantify {
@@ -32,6 +32,10 @@ export namespace quantify {
 
     UNIT(fathom, "ftm", 463, 250);
     UNIT(nautical_mile, "nmi", 1852, 1);
+
+    SCALE_UNITS(metric_meter, inches, feet, yard, mile, league, fathom, nautical_mile);
   }
+
+  BASE_DIMENSION(distance::scale, 0);
   //! @}
 } // namespace quantify
@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:electric_current;
+export module quantify.scales.electric_current;
 import quantify.core;
 
 export namespace quantify {
@@ -23,6 +23,10 @@ export namespace quantify {
   //! @{
   SCALE(electric_current) {
     METRIC_UNIT(ampere, "A", 1, 1);
+
+    SCALE_UNITS(metric_ampere);
   }
+
+  BASE_DIMENSION(electric_current::scale, 3);
   //! @}
 }
@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:light_intensity;
+export module quantify.scales.light_intensity;
 import quantify.core;
 
 export namespace quantify {
@@ -23,6 +23,10 @@ export namespace quantify {
   //! @{
   SCALE(light_intensity) {
     METRIC_UNIT(candela, "cd", 1, 1);
+
+    SCALE_UNITS(metric_candela);
   }
+
+  BASE_DIMENSION(light_intensity::scale, 6);
   //! @}
 }
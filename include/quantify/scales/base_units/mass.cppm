@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:mass;
+export module quantify.scales.mass;
 import quantify.core;
 
 export namespace quantify {
@@ -24,6 +24,10 @@ export namespace quantify {
   SCALE(mass) {
     METRIC_UNIT(grams, "g", 1, 1000);
     UNIT(ton, "T", 1000, 1);
+
+    SCALE_UNITS(metric_grams, ton);
   }
+
+  BASE_DIMENSION(mass::scale, 1);
   //! @}
 }
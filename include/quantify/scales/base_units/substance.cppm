@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:substance;
+export module quantify.scales.substance;
 import quantify.core;
 
 export namespace quantify {
@@ -23,6 +23,10 @@ export namespace quantify {
   //! @{
   SCALE(substance) {
     METRIC_UNIT(mole, "mol", 1, 1);
+
+    SCALE_UNITS(metric_mole);
   }
+
+  BASE_DIMENSION(substance::scale, 5);
   //! @}
 }
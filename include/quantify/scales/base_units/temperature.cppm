@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:temperature;
+export module quantify.scales.temperature;
 import quantify.core;
 
 export namespace quantify {
@@ -26,6 +26,7 @@ export namespace quantify {
       SCALE(kelvin) {}
       SCALE(celsius) {}
       SCALE(fahrenheit) {}
+      SCALE(rankine) {}
     }
 
     UNIT_IN_SCALE(scales::kelvin::scale, kelvin, "K", 1, 1);
@@ -34,7 +35,13 @@ export namespace quantify {
     UNIT_IN_SCALE(scales::celsius::scale, millicelsius, "mC", 1, 1000);
 
     UNIT_IN_SCALE(scales::fahrenheit::scale, fahrenheit, "F", 1, 1);
+
+    UNIT_IN_SCALE(scales::rankine::scale, rankine, "R", 1, 1);
+
+    SCALE_UNITS(kelvin, celsius, millicelsius, fahrenheit, rankine);
   }
+
+  BASE_DIMENSION(temperature::scales::kelvin::scale, 4);
   //! @}
 }
 
@@ -42,13 +49,9 @@ using namespace quantify::temperature;
 export
 {
 //@formatter:off
-  SCALE_CONVERSION(scales::kelvin::scale, scales::celsius::scale)
-    SCALE_FORWARD_CONVERSION(it - 273.15) SCALE_BACKWARD_CONVERSION(it + 273.15)
-
-  SCALE_CONVERSION(scales::celsius::scale, scales::fahrenheit::scale)
-    SCALE_FORWARD_CONVERSION((it * 9 / 5) + 32) SCALE_BACKWARD_CONVERSION((it - 32) * 5 / 9)
-
-  SCALE_CONVERSION(scales::kelvin::scale, scales::fahrenheit::scale)
-    SCALE_FORWARD_CONVERSION(((it - 273.15) * 9 / 5) + 32) SCALE_BACKWARD_CONVERSION(((it - 32) * 5 / 9) + 273.15)
+  // [C] = [K] - 273.15, [F] = [C] * 9/5 + 32 and [R] = [K] * 9/5; any other pair is composed
+  SCALE_AFFINE_CONVERSION(scales::kelvin::scale,  scales::celsius::scale,    1, 1, -27315, 100)
+  SCALE_AFFINE_CONVERSION(scales::celsius::scale, scales::fahrenheit::scale, 9, 5, 32,     1)
+  SCALE_AFFINE_CONVERSION(scales::kelvin::scale,  scales::rankine::scale,    9, 5, 0,      1)
 //@formatter:on
 }
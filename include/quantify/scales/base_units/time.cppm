@@ -15,7 +15,7 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:time;
+export module quantify.scales.time;
 import quantify.core;
 
 export namespace quantify {
@@ -36,6 +36,19 @@ export namespace quantify {
     UNIT(decades, "decades", years::factor<T>::numerator * 10, 1);
     UNIT(centuries, "centuries", decades::factor<T>::numerator * 10, 1);
     UNIT(millennia, "millennia", centuries::factor<T>::numerator * 10, 1);
+
+    SCALE_UNITS(
+      seconds, milliseconds, microseconds, nanoseconds,
+      minutes, hours, days, months, years, decades, centuries, millennia
+    );
   }
+
+  BASE_DIMENSION(time::scale, 2);
   //! @}
 } // namespace quantify
+
+export
+{
+  // std::chrono::duration<Rep, Period> <-> quantity<time::X, Rep>, e.g. std::nano <-> nanoseconds
+  CHRONO_SCALE(quantify::time::units, quantify::time::seconds);
+}
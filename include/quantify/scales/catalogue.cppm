@@ -0,0 +1,91 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  catalogue.cppm
+ *  \brief List of every built-in unit
+ *
+ */
+
+export module quantify.scales:catalogue;
+import quantify.core;
+
+import quantify.scales.distance;
+import quantify.scales.mass;
+import quantify.scales.temperature;
+import quantify.scales.time;
+import quantify.scales.electric_current;
+import quantify.scales.substance;
+import quantify.scales.light_intensity;
+import quantify.scales.angle;
+import quantify.scales.solid_angle;
+import quantify.scales.volume;
+import quantify.scales.force;
+import quantify.scales.pressure;
+import quantify.scales.electric_charge;
+import quantify.scales.energy;
+import quantify.scales.power;
+import quantify.scales.emf;
+import quantify.scales.electric_resistance;
+import quantify.scales.electric_conductance;
+import quantify.scales.electric_capacitance;
+import quantify.scales.magnetic_flux;
+import quantify.scales.magnetic_flux_density;
+import quantify.scales.inductance;
+import quantify.scales.frequency;
+import quantify.scales.absorbed_dose;
+import quantify.scales.dose_equivalent;
+import quantify.scales.radionuclide_activity;
+import quantify.scales.catalytic_activity;
+import quantify.scales.luminous_flux;
+import quantify.scales.illuminance;
+
+export namespace quantify {
+  /*! @brief Every unit declared by the built-in scales
+   *
+   * Used to generate the symbol tables of @ref quantify::parse.
+   */
+  using all_units = unit_list_t<
+    //* SI base units
+    distance::units,
+    mass::units,
+    temperature::units,
+    time::units,
+    electric_current::units,
+    substance::units,
+    light_intensity::units,
+    angle::units,
+    //* Derived units
+    solid_angle::units,
+    volume::units,
+    force::units,
+    pressure::units,
+    electric_charge::units,
+    energy::units,
+    power::units,
+    emf::units,
+    electric_resistance::units,
+    electric_conductance::units,
+    electric_capacitance::units,
+    magnetic_flux::units,
+    magnetic_flux_density::units,
+    inductance::units,
+    frequency::units,
+    absorbed_dose::units,
+    dose_equivalent::units,
+    radionuclide_activity::units,
+    catalytic_activity::units,
+    luminous_flux::units,
+    illuminance::units>;
+} // namespace quantify
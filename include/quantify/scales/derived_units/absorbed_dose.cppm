@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:absorbed_dose;
+export module quantify.scales.absorbed_dose;
 import quantify.core;
 
-import :energy;
-import :mass;
+import quantify.scales.energy;
+import quantify.scales.mass;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(absorbed_dose, mul<energy::scale, mass::scale>) {
     METRIC_UNIT(grays, "Gy", 1, 1);
+
+    SCALE_UNITS(metric_grays);
   }
   //! @}
 }
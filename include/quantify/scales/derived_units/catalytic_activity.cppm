@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:catalytic_activity;
+export module quantify.scales.catalytic_activity;
 import quantify.core;
 
-import :substance;
-import :time;
+import quantify.scales.substance;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(catalytic_activity, frac<substance::scale, time::scale>) {
     METRIC_UNIT(katals, "kat", 1, 1);
+
+    SCALE_UNITS(metric_katals);
   }
   //! @}
 }
@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:dose_equivalent;
+export module quantify.scales.dose_equivalent;
 import quantify.core;
 
-import :energy;
-import :mass;
+import quantify.scales.energy;
+import quantify.scales.mass;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(dose_equivalent, mul<energy::scale, mass::scale>) {
     METRIC_UNIT(sieverts, "Sv", 1, 1);
+
+    SCALE_UNITS(metric_sieverts);
   }
   //! @}
 }
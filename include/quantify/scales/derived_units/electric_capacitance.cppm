@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:electric_capacitance;
+export module quantify.scales.electric_capacitance;
 import quantify.core;
 
-import :emf;
-import :electric_charge;
+import quantify.scales.emf;
+import quantify.scales.electric_charge;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(electric_capacitance, frac<electric_charge::scale, emf::scale>) {
     METRIC_UNIT(farads, "F", 1, 1);
+
+    SCALE_UNITS(metric_farads);
   }
   //! @}
 }
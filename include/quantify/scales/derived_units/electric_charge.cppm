@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:electric_charge;
+export module quantify.scales.electric_charge;
 import quantify.core;
 
-import :electric_current;
-import :time;
+import quantify.scales.electric_current;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(electric_charge, mul<electric_current::scale, time::scale>) {
     METRIC_UNIT(coulombs, "C", 1, 1);
+
+    SCALE_UNITS(metric_coulombs);
   }
   //! @}
 }
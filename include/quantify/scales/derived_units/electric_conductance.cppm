@@ -16,16 +16,18 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:electric_conductance;
+export module quantify.scales.electric_conductance;
 import quantify.core;
 
-import :electric_resistance;
+import quantify.scales.electric_resistance;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(electric_conductance, frac<no_scale, electric_resistance::scale>) {
     METRIC_UNIT(siemens, "S", 1, 1);
+
+    SCALE_UNITS(metric_siemens);
   }
   //! @}
 }
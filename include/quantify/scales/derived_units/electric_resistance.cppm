@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:electric_resistance;
+export module quantify.scales.electric_resistance;
 import quantify.core;
 
-import :emf;
-import :electric_current;
+import quantify.scales.emf;
+import quantify.scales.electric_current;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(electric_resistance, frac<emf::scale, electric_current::scale>) {
     METRIC_UNIT(ohms, "ohm", 1, 1);
+
+    SCALE_UNITS(metric_ohms);
   }
   //! @}
 }
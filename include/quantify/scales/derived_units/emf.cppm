@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:emf;
+export module quantify.scales.emf;
 import quantify.core;
 
-import :power;
-import :electric_current;
+import quantify.scales.power;
+import quantify.scales.electric_current;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(emf, frac<power::scale, electric_current::scale>) {
     METRIC_UNIT(volts, "V", 1, 1);
+
+    SCALE_UNITS(metric_volts);
   }
   //! @}
 }
@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:energy;
+export module quantify.scales.energy;
 import quantify.core;
 
-import :force;
-import :distance;
+import quantify.scales.force;
+import quantify.scales.distance;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(energy, mul<force::scale, distance::scale>) {
     METRIC_UNIT(joule, "J", 1, 1);
+
+    SCALE_UNITS(metric_joule);
   }
   //! @}
 }
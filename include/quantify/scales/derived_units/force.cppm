@@ -15,18 +15,20 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:force;
+export module quantify.scales.force;
 import quantify.core;
 
-import :mass;
-import :distance;
-import :time;
+import quantify.scales.mass;
+import quantify.scales.distance;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(force, frac<mul<mass::scale, distance::scale>, mul<time::scale, time::scale>>) {
     UNIT(newtons, "N", 1, 1);
+
+    SCALE_UNITS(newtons);
   }
   //! @}
 }
@@ -16,16 +16,18 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:frequency;
+export module quantify.scales.frequency;
 import quantify.core;
 
-import :time;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(frequency, frac<no_scale, time::scale>) {
     METRIC_UNIT(hertz, "Hz", 1, 1);
+
+    SCALE_UNITS(metric_hertz);
   }
   //! @}
 }
@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:illuminance;
+export module quantify.scales.illuminance;
 import quantify.core;
 
-import :luminous_flux;
-import :distance;
+import quantify.scales.luminous_flux;
+import quantify.scales.distance;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(illuminance, frac<luminous_flux::scale, mul<distance::scale, distance::scale>>) {
     METRIC_UNIT(lux, "lx", 1, 1);
+
+    SCALE_UNITS(metric_lux);
   }
   //! @}
 }
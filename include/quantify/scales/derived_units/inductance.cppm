@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:inductance;
+export module quantify.scales.inductance;
 import quantify.core;
 
-import :electric_current;
-import :magnetic_flux;
+import quantify.scales.electric_current;
+import quantify.scales.magnetic_flux;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(inductance, frac<magnetic_flux::scale, electric_current::scale>) {
     METRIC_UNIT(henries, "H", 1, 1);
+
+    SCALE_UNITS(metric_henries);
   }
   //! @}
 }
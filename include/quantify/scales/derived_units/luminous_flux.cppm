@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:luminous_flux;
+export module quantify.scales.luminous_flux;
 import quantify.core;
 
-import :light_intensity;
-import :solid_angle;
+import quantify.scales.light_intensity;
+import quantify.scales.solid_angle;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(luminous_flux, mul<light_intensity::scale, solid_angle::scale>) {
     METRIC_UNIT(lumen, "lm", 1, 1);
+
+    SCALE_UNITS(metric_lumen);
   }
   //! @}
 }
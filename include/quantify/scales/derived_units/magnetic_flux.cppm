@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:magnetic_flux;
+export module quantify.scales.magnetic_flux;
 import quantify.core;
 
-import :emf;
-import :time;
+import quantify.scales.emf;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(magnetic_flux, mul<emf::scale, time::scale>) {
     METRIC_UNIT(webers, "Wb", 1, 1);
+
+    SCALE_UNITS(metric_webers);
   }
   //! @}
 }
@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:magnetic_flux_density;
+export module quantify.scales.magnetic_flux_density;
 import quantify.core;
 
-import :magnetic_flux;
-import :distance;
+import quantify.scales.magnetic_flux;
+import quantify.scales.distance;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(magnetic_flux_density, frac<magnetic_flux::scale, mul<distance::scale, distance::scale>>) {
     METRIC_UNIT(teslas, "T", 1, 1);
+
+    SCALE_UNITS(metric_teslas);
   }
   //! @}
 }
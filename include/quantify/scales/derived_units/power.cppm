@@ -16,17 +16,19 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:power;
+export module quantify.scales.power;
 import quantify.core;
 
-import :energy;
-import :time;
+import quantify.scales.energy;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(power, frac<energy::scale, time::scale>) {
     METRIC_UNIT(watts, "W", 1, 1);
+
+    SCALE_UNITS(metric_watts);
   }
   //! @}
 }
@@ -15,19 +15,21 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:pressure;
+export module quantify.scales.pressure;
 import quantify.core;
 
-import :mass;
-import :distance;
-import :time;
-import :force;
+import quantify.scales.mass;
+import quantify.scales.distance;
+import quantify.scales.time;
+import quantify.scales.force;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(pressure, frac<force::scale, mul<distance::scale, distance::scale>>) {
     METRIC_UNIT(pascals, "Pa", 1, 1);
+
+    SCALE_UNITS(metric_pascals);
   }
   //! @}
 }
@@ -16,16 +16,18 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:radionuclide_activity;
+export module quantify.scales.radionuclide_activity;
 import quantify.core;
 
-import :time;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(radionuclide_activity, frac<no_scale, time::scale>) {
     METRIC_UNIT(becquerels, "Bq", 1, 1);
+
+    SCALE_UNITS(metric_becquerels);
   }
   //! @}
 }
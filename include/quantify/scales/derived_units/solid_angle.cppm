@@ -16,16 +16,18 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:solid_angle;
+export module quantify.scales.solid_angle;
 import quantify.core;
 
-import :angle;
+import quantify.scales.angle;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(solid_angle, mul<angle::scale, angle::scale>) {
     METRIC_UNIT(steradian, "sr", 1, 1);
+
+    SCALE_UNITS(metric_steradian);
   }
   //! @}
 }
@@ -15,11 +15,11 @@
 
 module;
 #include "quantify/unit_macros.h"
-export module quantify.scales:speed;
+export module quantify.scales.speed;
 import quantify.core;
 
-import :distance;
-import :time;
+import quantify.scales.distance;
+import quantify.scales.time;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
@@ -16,16 +16,18 @@
 module;
 #include "quantify/unit_macros.h"
 
-export module quantify.scales:volume;
+export module quantify.scales.volume;
 import quantify.core;
 
-import :distance;
+import quantify.scales.distance;
 
 export namespace quantify {
   //! @addtogroup derived_units Derived scales
   //! @{
   DERIVED_SCALE(volume, mul<distance::scale, distance::scale, distance::scale>) {
     METRIC_UNIT(liters, "L", 1, 1);
+
+    SCALE_UNITS(metric_liters);
   }
   //! @}
 }
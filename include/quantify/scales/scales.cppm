@@ -19,37 +19,43 @@
  */
 
 /*! @brief Built-in unit scales
+ *
+ * Every scale is also a module of its own, e.g. `quantify.scales.distance`, that only imports
+ * `quantify.core` and the scales it is derived from. Translation units that need a few scales
+ * can import those instead of this whole catalogue.
  */
 export module quantify.scales;
 //* SI base units
-export import :distance;
-export import :mass;
-export import :temperature;
-export import :time;
-export import :electric_current;
-export import :substance;
-export import :light_intensity;
-export import :angle;
+export import quantify.scales.distance;
+export import quantify.scales.mass;
+export import quantify.scales.temperature;
+export import quantify.scales.time;
+export import quantify.scales.electric_current;
+export import quantify.scales.substance;
+export import quantify.scales.light_intensity;
+export import quantify.scales.angle;
 //* Derived units
-export import :solid_angle;
-export import :volume;
-export import :speed;
-export import :force;
-export import :pressure;
-export import :electric_charge;
-export import :energy;
-export import :power;
-export import :emf;
-export import :electric_resistance;
-export import :electric_conductance;
-export import :electric_capacitance;
-export import :magnetic_flux;
-export import :magnetic_flux_density;
-export import :inductance;
-export import :frequency;
-export import :absorbed_dose;
-export import :dose_equivalent;
-export import :radionuclide_activity;
-export import :catalytic_activity;
-export import :luminous_flux;
-export import :illuminance;
+export import quantify.scales.solid_angle;
+export import quantify.scales.volume;
+export import quantify.scales.speed;
+export import quantify.scales.force;
+export import quantify.scales.pressure;
+export import quantify.scales.electric_charge;
+export import quantify.scales.energy;
+export import quantify.scales.power;
+export import quantify.scales.emf;
+export import quantify.scales.electric_resistance;
+export import quantify.scales.electric_conductance;
+export import quantify.scales.electric_capacitance;
+export import quantify.scales.magnetic_flux;
+export import quantify.scales.magnetic_flux_density;
+export import quantify.scales.inductance;
+export import quantify.scales.frequency;
+export import quantify.scales.absorbed_dose;
+export import quantify.scales.dose_equivalent;
+export import quantify.scales.radionuclide_activity;
+export import quantify.scales.catalytic_activity;
+export import quantify.scales.luminous_flux;
+export import quantify.scales.illuminance;
+//* Catalogue
+export import :catalogue;
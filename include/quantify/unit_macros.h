@@ -16,8 +16,14 @@
 //! @defgroup preprocessor_macros Preprocessor Macros
 //! @{
 #define UNIT_SYMBOL(...)                                                                           \
-  static constexpr inline std::string symbol() noexcept {                                          \
-    return (__VA_ARGS__);                                                                          \
+  static constexpr auto symbol_literal() noexcept {                                                \
+    return quantify::fixed_string{__VA_ARGS__};                                                    \
+  }                                                                                                \
+  static constexpr std::string_view symbol_view() noexcept {                                       \
+    return quantify::static_symbol<&symbol_literal>.view();                                        \
+  }                                                                                                \
+  static inline std::string symbol() noexcept {                                                    \
+    return std::string{symbol_view()};                                                             \
   }
 
 #define SCALE(NAME)                                                                                \
@@ -66,9 +72,51 @@
   UNIT(deca##UNIT_NAME, "D" SYMBOL, 10UL * (FACTOR_NUM), 1UL * (FACTOR_DEN));                      \
   UNIT(hecto##UNIT_NAME, "h" SYMBOL, 100UL * (FACTOR_NUM), 1UL * (FACTOR_DEN));                    \
   UNIT(kilo##UNIT_NAME, "k" SYMBOL, 1000UL * (FACTOR_NUM), 1UL * (FACTOR_DEN));                    \
-  UNIT(mega##UNIT_NAME, "M" SYMBOL, 1000000UL * (FACTOR_NUM), 1UL * (FACTOR_DEN))
+  UNIT(mega##UNIT_NAME, "M" SYMBOL, 1000000UL * (FACTOR_NUM), 1UL * (FACTOR_DEN));                 \
+  using metric_##UNIT_NAME = quantify::unit_list<                                                  \
+    nano##UNIT_NAME,                                                                               \
+    micro##UNIT_NAME,                                                                              \
+    milli##UNIT_NAME,                                                                              \
+    centi##UNIT_NAME,                                                                              \
+    deci##UNIT_NAME,                                                                               \
+    UNIT_NAME,                                                                                     \
+    deca##UNIT_NAME,                                                                               \
+    hecto##UNIT_NAME,                                                                              \
+    kilo##UNIT_NAME,                                                                               \
+    mega##UNIT_NAME>
+
+//! Lists the units of the enclosing scale, as units or lists of units such as `metric_meter`
+#define SCALE_UNITS(...) using units = quantify::unit_list_t<__VA_ARGS__>
+
+//! Assigns lane `LANE` of `quantify::dimension` to the base scale `SCALE`
+#define BASE_DIMENSION(SCALE, LANE)                                                                \
+  template <>                                                                                      \
+  struct base_dimension<SCALE> {                                                                   \
+    static constexpr unsigned lane = LANE;                                                         \
+  }
+
+//! Maps every `std::chrono::duration` period onto a unit of the time scale listing `UNITS`: the
+//! unit with the same factor, or a `quantify::period_unit` of `BASE_UNIT` if there is none
+#define CHRONO_SCALE(UNITS, BASE_UNIT)                                                             \
+  template <std::intmax_t NUM, std::intmax_t DEN>                                                  \
+  struct quantify::duration_unit<std::ratio<NUM, DEN>> {                                           \
+    using type = quantify::detail::chrono_unit_t<UNITS, BASE_UNIT, std::ratio<NUM, DEN>>;          \
+  }
 
+//! Declares scale `TO` as a child of scale `FROM` in the tree of affine scale conversions, such
+//! that `[TO] = [FROM] * SCALE_NUM / SCALE_DEN + OFFSET_NUM / OFFSET_DEN` in their base units
+#define SCALE_AFFINE_CONVERSION(FROM, TO, SCALE_NUM, SCALE_DEN, OFFSET_NUM, OFFSET_DEN)            \
+  template <>                                                                                      \
+  struct quantify::affine_scale_edge<TO> {                                                         \
+    using parent = FROM;                                                                           \
+    static constexpr quantify::affine_map map{                                                     \
+      quantify::exact_ratio{SCALE_NUM, SCALE_DEN}.reduced(),                                       \
+      quantify::exact_ratio{OFFSET_NUM, OFFSET_DEN}.reduced(),                                     \
+    };                                                                                             \
+  };
 
+//! Declares an arbitrary conversion between two scales, see `SCALE_AFFINE_CONVERSION` for affine
+//! conversions
 #define SCALE_CONVERSION(FROM, TO)                                                                 \
   template <>                                                                                      \
   struct quantify::scale_conversion_t<FROM, TO> {                                                  \
@@ -79,7 +127,7 @@
   template <typename U_FROM, typename U_TO, typename T>                                            \
     requires quantify::CompareScales<from_scale, typename U_FROM::scale> &&                        \
              quantify::CompareScales<to_scale, typename U_TO::scale>                               \
-  static quantity<U_TO, T> forward(const quantity<U_FROM, T>& _quantity) {                         \
+  static constexpr quantity<U_TO, T> forward(const quantity<U_FROM, T>& _quantity) noexcept {      \
     quantity<U_TO, T> result{                                                                      \
       _quantity.value * U_FROM::template factor<T>::numerator /                                    \
       U_FROM::template factor<T>::denominator                                                      \
@@ -95,7 +143,7 @@
   template <typename U_FROM, typename U_TO, typename T>                                            \
     requires quantify::CompareScales<to_scale, typename U_FROM::scale> &&                          \
              quantify::CompareScales<from_scale, typename U_TO::scale>                             \
-  static quantity<U_TO, T> backward(const quantity<U_FROM, T>& _quantity) {                        \
+  static constexpr quantity<U_TO, T> backward(const quantity<U_FROM, T>& _quantity) noexcept {     \
     quantity<U_TO, T> result{                                                                      \
       _quantity.value * U_FROM::template factor<T>::numerator /                                    \
       U_FROM::template factor<T>::denominator                                                      \
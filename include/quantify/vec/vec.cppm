@@ -0,0 +1,248 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*! \file  vec.cppm
+ *  \brief Fixed-size vectors as the data type of quantities
+ *
+ */
+
+export module quantify.vec;
+import std;
+import quantify.core;
+
+export namespace quantify {
+  //! @cond NEVER
+  namespace detail {
+    //! Largest power of two that divides `size`, up to the width of an AVX-512 register
+    consteval std::size_t vec_alignment(std::size_t size, std::size_t align) noexcept {
+      std::size_t alignment = align;
+      while (alignment < 64 && size % (alignment * 2) == 0) {
+        alignment *= 2;
+      }
+      return alignment;
+    }
+  } // namespace detail
+  //! @endcond
+
+  /*! @brief Fixed-size vector of `N` elements, used as the data type of vector quantities
+   *
+   * `quantity<U, vec<T, N>>` holds positions, velocities or forces with one unit for all of
+   * their components. Conversions scale every component by the same compile-time factor, and
+   * element-wise operators are plain loops over `N` that the compiler unrolls and vectorizes.
+   *
+   * Storage is aligned to the largest power of two that divides its size, up to 64 bytes, so
+   * `vec<double, 4>` can be loaded with aligned vector instructions while arrays of
+   * `vec<double, 3>` stay as packed as arrays of `std::array<double, 3>`.
+   *
+   * @tparam T Type of the components
+   * @tparam N Number of components
+   */
+  template <typename T, std::size_t N>
+  struct alignas(detail::vec_alignment(sizeof(T) * N, alignof(T))) vec {
+    static_assert(N > 0, "Vectors need at least one component.");
+
+    T data[N]{};
+
+    [[nodiscard]]
+    static constexpr std::size_t size() noexcept {
+      return N;
+    }
+
+    constexpr T& operator[](std::size_t i) noexcept {
+      return data[i];
+    }
+
+    constexpr const T& operator[](std::size_t i) const noexcept {
+      return data[i];
+    }
+
+    constexpr T* begin() noexcept {
+      return data;
+    }
+
+    constexpr T* end() noexcept {
+      return data + N;
+    }
+
+    constexpr const T* begin() const noexcept {
+      return data;
+    }
+
+    constexpr const T* end() const noexcept {
+      return data + N;
+    }
+
+    constexpr vec& operator+=(const vec& rhs) noexcept {
+      for (std::size_t i = 0; i < N; ++i) {
+        data[i] += rhs.data[i];
+      }
+      return *this;
+    }
+
+    constexpr vec& operator-=(const vec& rhs) noexcept {
+      for (std::size_t i = 0; i < N; ++i) {
+        data[i] -= rhs.data[i];
+      }
+      return *this;
+    }
+
+    constexpr vec& operator*=(const T& rhs) noexcept {
+      for (std::size_t i = 0; i < N; ++i) {
+        data[i] *= rhs;
+      }
+      return *this;
+    }
+
+    constexpr vec& operator/=(const T& rhs) noexcept {
+      for (std::size_t i = 0; i < N; ++i) {
+        data[i] /= rhs;
+      }
+      return *this;
+    }
+
+    friend constexpr vec operator+(vec lhs, const vec& rhs) noexcept {
+      return lhs += rhs;
+    }
+
+    friend constexpr vec operator-(vec lhs, const vec& rhs) noexcept {
+      return lhs -= rhs;
+    }
+
+    friend constexpr vec operator*(vec lhs, const T& rhs) noexcept {
+      return lhs *= rhs;
+    }
+
+    friend constexpr vec operator*(const T& lhs, vec rhs) noexcept {
+      return rhs *= lhs;
+    }
+
+    friend constexpr vec operator/(vec lhs, const T& rhs) noexcept {
+      return lhs /= rhs;
+    }
+
+    constexpr vec operator-() const noexcept {
+      vec result{};
+      for (std::size_t i = 0; i < N; ++i) {
+        result.data[i] = -data[i];
+      }
+      return result;
+    }
+
+    constexpr bool operator==(const vec&) const noexcept = default;
+  };
+
+  template <typename T, typename... Ts>
+  vec(T, Ts...) -> vec<T, 1 + sizeof...(Ts)>;
+
+  //! Sum of the products of the components of `lhs` and `rhs`
+  template <typename T, std::size_t N>
+  constexpr T dot(const vec<T, N>& lhs, const vec<T, N>& rhs) noexcept {
+    T result{};
+    for (std::size_t i = 0; i < N; ++i) {
+      result += lhs[i] * rhs[i];
+    }
+    return result;
+  }
+
+  //! Cross product of two 3-D vectors
+  template <typename T>
+  constexpr vec<T, 3> cross(const vec<T, 3>& lhs, const vec<T, 3>& rhs) noexcept {
+    return {{
+      lhs[1] * rhs[2] - lhs[2] * rhs[1],
+      lhs[2] * rhs[0] - lhs[0] * rhs[2],
+      lhs[0] * rhs[1] - lhs[1] * rhs[0],
+    }};
+  }
+
+  //! Euclidean norm of `v`
+  template <std::floating_point T, std::size_t N>
+  T norm(const vec<T, N>& v) noexcept {
+    return std::sqrt(dot(v, v));
+  }
+
+  /*! @brief Scales every component by the same factor, and offsets it by the same amount
+   *
+   * Makes @ref quantify::apply_factor and @ref quantify::affine_conversion, and with them every
+   * unit conversion, work on vectors. Each component is converted like a scalar `T` would be.
+   */
+  template <typename T, std::size_t N>
+  struct representation_traits<vec<T, N>> {
+    static constexpr bool is_specialized = true;
+
+    template <exact_ratio F, exact_ratio O = exact_ratio{0, 1}>
+    [[nodiscard]]
+    static constexpr vec<T, N> scale(const vec<T, N>& value) noexcept {
+      vec<T, N> result{};
+      for (std::size_t i = 0; i < N; ++i) {
+        result[i] = detail::apply_affine<F, O>(value[i]);
+      }
+      return result;
+    }
+  };
+
+  //! Vector quantity times scalar quantity, e.g. a velocity times a time is a displacement
+  template <typename U_L, typename U_R, typename T, std::size_t N>
+  constexpr quantity<detail::product_unit_t<U_L, U_R, T>, vec<T, N>>
+  operator*(const quantity<U_L, vec<T, N>>& lhs, const quantity<U_R, T>& rhs) noexcept {
+    return {lhs.value * detail::converted_operand<U_L, U_R>(rhs.value)};
+  }
+
+  template <typename U_L, typename U_R, typename T, std::size_t N>
+  constexpr quantity<detail::product_unit_t<U_R, U_L, T>, vec<T, N>>
+  operator*(const quantity<U_L, T>& lhs, const quantity<U_R, vec<T, N>>& rhs) noexcept {
+    return {detail::converted_operand<U_R, U_L>(lhs.value) * rhs.value};
+  }
+
+  //! Vector quantity over scalar quantity, e.g. a displacement over a time is a velocity
+  template <typename U_L, typename U_R, typename T, std::size_t N>
+  constexpr quantity<detail::quotient_unit_t<U_L, U_R, T>, vec<T, N>>
+  operator/(const quantity<U_L, vec<T, N>>& lhs, const quantity<U_R, T>& rhs) noexcept {
+    return {lhs.value / detail::converted_operand<U_L, U_R>(rhs.value)};
+  }
+
+  /*! @brief Dot product of two vector quantities
+   *
+   * Its unit is that of the product of their units, e.g. a force dotted with a displacement is
+   * an energy. If both belong to the same scale, `rhs` is converted once into the unit of `lhs`.
+   */
+  template <typename U_L, typename U_R, typename T, std::size_t N>
+  constexpr quantity<detail::product_unit_t<U_L, U_R, T>, T>
+  dot(const quantity<U_L, vec<T, N>>& lhs, const quantity<U_R, vec<T, N>>& rhs) noexcept {
+    return {detail::converted_operand<U_L, U_R>(dot(lhs.value, rhs.value))};
+  }
+
+  //! Cross product of two 3-D vector quantities, with the unit of the product of their units
+  template <typename U_L, typename U_R, typename T>
+  constexpr quantity<detail::product_unit_t<U_L, U_R, T>, vec<T, 3>>
+  cross(const quantity<U_L, vec<T, 3>>& lhs, const quantity<U_R, vec<T, 3>>& rhs) noexcept {
+    return {detail::converted_operand<U_L, U_R>(cross(lhs.value, rhs.value))};
+  }
+
+  //! Euclidean norm of a vector quantity, as a scalar quantity of the same unit
+  template <typename U, std::floating_point T, std::size_t N>
+  quantity<U, T> norm(const quantity<U, vec<T, N>>& q) noexcept {
+    return {norm(q.value)};
+  }
+
+  //! Component `i` of a vector quantity, as a scalar quantity of the same unit
+  template <typename U, typename T, std::size_t N>
+  constexpr quantity<U, T> component(const quantity<U, vec<T, N>>& q, std::size_t i) noexcept {
+    return {q.value[i]};
+  }
+
+  static_assert(is_layout_transparent_v<no_unit, vec<double, 3>>);
+  static_assert(sizeof(vec<double, 3>) == sizeof(std::array<double, 3>));
+  static_assert(alignof(vec<double, 4>) == 32 && alignof(vec<float, 4>) == 16);
+} // namespace quantify
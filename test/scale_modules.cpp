@@ -0,0 +1,43 @@
+// Copyright (c) 2024-2025, Víctor Castillo Agüero.
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+//! Only imports the core, the scales and the features it uses, to make sure they stand on their
+//! own.
+
+#include "common.h"
+
+import quantify.core;
+import quantify.math;
+import quantify.scales.distance;
+import quantify.scales.time;
+import quantify.scales.speed;
+
+using namespace quantify;
+using namespace quantify::distance;
+using namespace quantify::time;
+
+void setup() {
+}
+
+TEST("Importing single scales") {
+  constexpr Q<kilometer, double> d{1.5};
+  constexpr Q<minutes, double>   t{0.5};
+  static_assert(d.as<meter>().value == 1500.0);
+  static_assert((d / t).as<frac<meter, seconds>>().value == 50.0);
+  static_assert(speed::quantity<Q<frac<meter, seconds>, double>>);
+  static_assert(pow<2>(d).as<mul<meter, meter>>().value == 2250000.0);
+  static_assert(Q<seconds, double>{std::chrono::milliseconds{1500}}.value == 1.5);
+  return 0;
+}
@@ -136,19 +136,100 @@ TEST("Unit reduction") {
 
 //@formatter:on
 
-  // mechanics::newton::second_law
-  //   ::isolate<mechanics::newton::second_law::acceleration>
-  //   ::substitute<mechanics::newton::second_law::force>(1.0)
-  //   ::substitute<mechanics::newton::second_law::mass>(1.0);
-  //
-  // using second_law = mechanics::newton::second_law;
-  // second_law::isolate<second_law::acceleration>
-  //           ::substitute<second_law::force>(1.0)
-  //           ::substitute<second_law::mass>(1.0);
+  return 0;
+}
+
+TEST("Canonical units") {
+//@formatter:off
+  assert_unit   <frac<no_unit, mul<no_unit>>>                      ::reduces_to<no_unit>();
+  assert_unit   <frac<mul<no_unit, no_unit>, no_unit>>              ::reduces_to<no_unit>();
+  assert_unit   <mul<meter, seconds, meter>>                       ::reduces_to<mul<meter, meter, seconds>>();
+  assert_unit   <mul<frac<meter, seconds>, frac<seconds, meter>>>  ::reduces_to<no_unit>();
+  assert_unit   <frac<mul<meter, kilograms, seconds, meter, kilograms, seconds, meter, kilograms>,
+                      mul<seconds, kilograms, meter, seconds, kilograms, meter, seconds, kilograms>>>
+                                                                    ::reduces_to<frac<meter, seconds>>();
+//@formatter:on
+
+  using long_expr = mul<frac<meter, seconds>, frac<kilograms, meter>, frac<seconds, kilograms>, meter, frac<meter, seconds>>;
+  static_assert(std::is_same_v<reduce<reduce<long_expr>>, reduce<long_expr>>);
+  static_assert(std::is_same_v<reduce<long_expr>, frac<mul<meter, meter>, seconds>>);
+
+  static_assert(SameScale<frac<mul<kilograms, meter>, mul<seconds, seconds>>, force::newtons>);
+  static_assert(SameScale<frac<mul<meter, kilograms>, mul<seconds, seconds>>, force::newtons>);
+  static_assert(SameScale<mul<frac<meter, seconds>, frac<kilograms, seconds>>, force::newtons>);
+  static_assert(!SameScale<frac<mul<meter, meter, kilograms>, mul<seconds, seconds>>, force::newtons>);
 
   return 0;
 }
 
+TEST("Unit symbols") {
+  constexpr std::string_view speed_symbol = frac<kilometer, hours>::symbol_view();
+  constexpr std::string_view area_symbol  = mul<meter, meter>::symbol_view();
+
+  static_assert(speed_symbol == "(km)/(hours)");
+  static_assert(area_symbol == "m*m");
+
+  if (speed_symbol.data() != frac<kilometer, hours>::symbol_view().data()) {
+    std::cerr << "[FAIL] symbol views do not share static storage" << std::endl;
+    return 1;
+  }
+  if (frac<kilometer, hours>::symbol() != speed_symbol) {
+    std::cerr << "[FAIL] [" << frac<kilometer, hours>::symbol() << "] != [" << speed_symbol << "]" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Formatting") {
+  Q<meter, double> d{1234.5};
+  Q<meter, int>    i{42};
+
+  const std::pair<std::string, std::string> cases[] = {
+    {std::format("{}", d), "1234.5 m"},
+    {std::format("{:.2f}", d), "1234.50 m"},
+    {std::format("{:.1en}", d), "1.2e+03"},
+    {std::format("{:n}", i), "42"},
+    {std::format("{:.3f}", format_as<kilometer>(d)), "1.234 km"},
+    {std::format("{}", Q<frac<meter, seconds>, int>{3}), "3 (m)/(s)"},
+  };
+  for (const auto& [formatted, expected]: cases) {
+    if (formatted != expected) {
+      std::cerr << "[FAIL] formatted [" << formatted << "] (expected [" << expected << "])" << std::endl;
+      return 1;
+    }
+  }
+
+  // Values longer than the stack buffer, such as 1e300 in fixed notation
+  if (std::format("{:f}", Q<meter, double>{1e300}).size() != 303 ||
+      std::format("{:.200fn}", Q<meter, double>{0.5}).size() != 202) {
+    std::cerr << "[FAIL] formatting long values" << std::endl;
+    return 1;
+  }
+
+  try {
+    (void) std::vformat("{:.2}", std::make_format_args(i));
+    std::cerr << "[FAIL] precision accepted for an integral quantity" << std::endl;
+    return 1;
+  } catch (const std::format_error&) {
+  }
+
+  try {
+    (void) std::vformat("{:.100000}", std::make_format_args(d));
+    std::cerr << "[FAIL] unbounded precision accepted" << std::endl;
+    return 1;
+  } catch (const std::format_error&) {
+  }
+
+  // Streams write the same text as to_string(), padded as a whole
+  std::ostringstream stream{};
+  stream << std::setw(20) << std::left << i << '|' << d;
+  if (stream.str() != std::format("{:<20}|{}", i.to_string(), d.to_string())) {
+    std::cerr << "[FAIL] streamed [" << stream.str() << "]" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
 TEST("Unit conversion") {
   Q<frac<meter,seconds>, double> vel = 100.0;
   std::cout << "v: " << vel << std::endl;
@@ -160,6 +241,118 @@ TEST("Unit conversion") {
   return 0;
 }
 
+TEST("Batch conversion") {
+  std::vector<Q<millimeter, double>> lengths(1003);
+  std::vector<Q<meter, double>>      meters(lengths.size());
+  for (std::size_t i = 0; i < lengths.size(); ++i) {
+    lengths[i] = static_cast<double>(i);
+  }
+  if (!convert<meter>(std::span{lengths}, std::span{meters})) {
+    std::cerr << "[FAIL] batch conversion rejected buffers of the same size" << std::endl;
+    return 1;
+  }
+  for (std::size_t i = 0; i < lengths.size(); ++i) {
+    if (std::abs(meters[i].value - lengths[i].as<meter>().value) > 1e-12) {
+      std::cerr << "[FAIL] " << lengths[i] << " converted to " << meters[i] << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<Q<celsius, float>> temperatures(37);
+  for (std::size_t i = 0; i < temperatures.size(); ++i) {
+    temperatures[i] = static_cast<float>(i) * 2.5f - 40.0f;
+  }
+  const auto expected = temperatures;
+  const auto kelvins  = convert_in_place<kelvin>(std::span{temperatures});
+  for (std::size_t i = 0; i < kelvins.size(); ++i) {
+    if (std::abs(kelvins[i].value - expected[i].as<kelvin>().value) > 1e-3f) {
+      std::cerr << "[FAIL] " << expected[i] << " converted to " << kelvins[i] << std::endl;
+      return 1;
+    }
+  }
+
+  // The coefficients are rounded once from the exact map, not evaluated in float
+  static_assert(linear_conversion<millicelsius, kelvin, float>::scale == 0.001f);
+  std::vector<Q<millicelsius, float>> millis{10000.0f, -273150.0f};
+  std::vector<Q<kelvin, float>>       kelvins_from_millis(millis.size());
+  if (!convert<kelvin>(std::span{millis}, std::span{kelvins_from_millis}) ||
+      std::abs(kelvins_from_millis[0].value - 283.15f) > 1e-4f ||
+      std::abs(kelvins_from_millis[1].value) > 1e-4f) {
+    std::cerr << "[FAIL] " << millis[0] << " converted to " << kelvins_from_millis[0] << std::endl;
+    return 1;
+  }
+
+  std::vector<Q<meter, int>> ints{1000, 2500, 3000};
+  std::vector<Q<kilometer, int>> kms(ints.size());
+  if (!convert<kilometer>(std::span{ints}, std::span{kms}) || kms[0].value != 1 || kms[1].value != 2 || kms[2].value != 3) {
+    std::cerr << "[FAIL] integer batch conversion" << std::endl;
+    return 1;
+  }
+  const auto mismatched = convert<kilometer>(std::span{ints}, std::span{kms}.first(2));
+  if (mismatched || mismatched.error() != std::errc::invalid_argument) {
+    std::cerr << "[FAIL] batch conversion between buffers of different sizes" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Exact conversion factors") {
+  static_assert(conversion_factor_v<kilometer, meter> == exact_ratio{1000, 1});
+  static_assert(conversion_factor_v<frac<kilometer, hours>, frac<meter, seconds>> == exact_ratio{5, 18});
+  static_assert(unit_factor_v<mul<nanoseconds, nanoseconds, nanometer>> ==
+                exact_ratio{1, static_cast<exact_int>(1000000000) * 1000000000 * 1000000000});
+  // Integer factors multiply in a wider type, so results out of range wrap instead of overflowing
+  static_assert(apply_factor<exact_ratio{1000, 1}>(std::numeric_limits<std::int64_t>::max()) ==
+                static_cast<std::int64_t>(static_cast<exact_int>(std::numeric_limits<std::int64_t>::max()) * 1000));
+  // Factors are correctly rounded to floating point, even when their terms are not exact in it
+  static_assert(exact_ratio{1, 3}.as<float>() == 1.0f / 3.0f);
+  static_assert(exact_ratio{16777217, 1}.as<float>() == 16777216.0f);
+  static_assert(exact_ratio{-16777219, 1}.as<float>() == -16777220.0f);
+  static_assert(exact_ratio{(exact_int{1} << 64) + 1, 3}.as<double>() == 0x1.5555555555555p+62);
+  static_assert(exact_ratio{static_cast<exact_int>(1000000000000000) * 1000000000000000 + 7,
+                            3000000000001}
+                  .as<double>() == 0x1.280f39a347e8dp+58);
+
+  Q<frac<meter, seconds>, int> still   = 0;
+  Q<frac<meter, hours>, int>   slow    = 1;
+  Q<frac<meter, hours>, int>   walking = 3600;
+  if (still == slow || !(still < slow) || !(walking == Q<frac<meter, seconds>, int>{1})) {
+    std::cerr << "[FAIL] integer comparison across units truncated" << std::endl;
+    return 1;
+  }
+
+  if (Q<meter, int>{1500}.as<kilometer>().value != 1 || Q<kilometer, int>{2}.as<meter>().value != 2000) {
+    std::cerr << "[FAIL] integer conversion" << std::endl;
+    return 1;
+  }
+
+  if (Q<frac<kilometer, hours>, double>{36.0}.as<frac<meter, seconds>>().value != 10.0) {
+    std::cerr << "[FAIL] composite unit conversion" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Constant-folded arithmetic") {
+  constexpr Q<frac<kilometer, hours>, double> max_speed{120.0};
+  constexpr Q<meter, double>                  track = Q<meter, double>{100.0} + Q<kilometer, double>{1.0};
+  constexpr Q<seconds, double>                lap{10.0};
+  constexpr auto                              lap_speed = track / lap;
+
+  static_assert(track.value == 1100.0);
+  static_assert(lap_speed.value == 110.0);
+  static_assert(lap_speed > max_speed.as<frac<meter, seconds>>());
+  static_assert(Q<meter, int>{1} < Q<kilometer, int>{1});
+  static_assert(Q<celsius, double>{0.0}.as<kelvin>().value == 273.15);
+  static_assert((2.0 / lap).value == 0.2);
+  static_assert(std::is_same_v<decltype(2.0 / lap), Q<frac<no_unit, seconds>, double>>);
+
+  static_assert(noexcept(track + track) && noexcept(track / lap) && noexcept(track < track));
+  static_assert(is_layout_transparent_v<frac<kilometer, hours>, double>);
+  static_assert(std::is_trivially_copyable_v<Q<mul<meter, seconds>, float>>);
+  return 0;
+}
+
 TEST("Quantity comparison") {
   Q<frac<meter,seconds>, int> vel = 100.0;
   Q<frac<meter,seconds>, int> vel1 = 150.0;
@@ -186,6 +379,737 @@ TEST("Quantity comparison") {
   return 0;
 }
 
+TEST("Affine scale conversions") {
+  // millicelsius -> fahrenheit is folded into a single map
+  static_assert(affine_conversion<millicelsius, fahrenheit>::map == affine_map{{9, 5000}, {32, 1}});
+  static_assert(affine_conversion<fahrenheit, kelvin>::map == affine_map{{5, 9}, {45967, 180}});
+  static_assert(affine_conversion<kelvin, rankine>::map == affine_map{{9, 5}, {0, 1}});
+
+  static_assert(Q<millicelsius, double>{100000.0}.as<fahrenheit>().value == 212.0);
+  static_assert(Q<fahrenheit, double>{-40.0}.as<celsius>().value == -40.0);
+  static_assert(std::abs(Q<rankine, double>{491.67}.as<celsius>().value) < 1e-12);
+  static_assert(Q<celsius, int>{100}.as<fahrenheit>().value == 212);
+  static_assert(Q<fahrenheit, int>{-40}.as<millicelsius>().value == -40000);
+  static_assert(Q<kelvin, std::int64_t>{1}.as<rankine>().value == 1);
+
+  static_assert(ConvertibleScales<scales::rankine::scale, scales::fahrenheit::scale, rankine, fahrenheit, double>);
+  static_assert(!AffineScales<scales::kelvin::scale, scales::kelvin::scale>);
+  static_assert(!AffineScales<scales::kelvin::scale, distance::scale>);
+  return 0;
+}
+
+TEST("Chrono interoperability") {
+  using namespace std::chrono_literals;
+
+  // Periods map onto the units with the same factor, or onto a unit of their own
+  static_assert(std::same_as<duration_unit_t<std::nano>, nanoseconds>);
+  static_assert(std::same_as<duration_unit_t<std::ratio<60>>, minutes>);
+  static_assert(std::same_as<decltype(quantify::quantity{5ms}), Q<milliseconds, std::chrono::milliseconds::rep>>);
+  static_assert(duration_unit_t<std::ratio<1, 60>>::symbol_view() == "(1/60)s");
+
+  // Integer ticks are copied as they are when the periods match
+  constexpr Q<nanoseconds, std::int64_t> ticks = std::chrono::nanoseconds{123456789};
+  static_assert(ticks.value == 123456789);
+  static_assert(std::chrono::nanoseconds{ticks} == 123456789ns);
+  static_assert(Q<nanoseconds, std::int64_t>{2s}.value == 2000000000);
+  static_assert(Q<seconds, double>{1500ms}.value == 1.5);
+  static_assert(Q<milliseconds, std::int64_t>{std::chrono::duration<double>{2.5}}.value == 2500);
+  static_assert(static_cast<std::chrono::seconds>(Q<milliseconds, std::int64_t>{2999}) == 2s);
+  static_assert(std::chrono::duration<double>{Q<minutes, double>{0.5}}.count() == 30.0);
+  static_assert(std::chrono::steady_clock::duration{Q<seconds, std::int64_t>{1}} == 1s);
+
+  // Lossy conversions are explicit, like between durations
+  static_assert(std::is_convertible_v<std::chrono::seconds, Q<milliseconds, std::int64_t>>);
+  static_assert(!std::is_convertible_v<std::chrono::milliseconds, Q<seconds, std::int64_t>>);
+  static_assert(std::is_convertible_v<Q<seconds, std::int64_t>, std::chrono::milliseconds>);
+  static_assert(!std::is_convertible_v<Q<seconds, double>, std::chrono::seconds>);
+  static_assert(!std::is_constructible_v<Q<meter, double>, std::chrono::seconds>);
+
+  // Arithmetic and comparisons with durations
+  static_assert(Q<milliseconds, std::int64_t>{500} + 1s == 1500ms);
+  static_assert(Q<milliseconds, std::int64_t>{1500} - 1s == 500ms);
+  static_assert(Q<seconds, double>{1} < 1001ms && Q<seconds, double>{1} > 999ms);
+
+  // Durations as denominators of derived units
+  constexpr Q<frac<meter, seconds>, double> speed = Q<meter, double>{100} / 50ms;
+  static_assert(speed.value == 2000.0);
+  static_assert(std::same_as<decltype(Q<meter, double>{1} / 1ns)::unit, frac<meter, nanoseconds>>);
+  static_assert((speed * 2min).as<kilometer>().value == 240.0);
+  static_assert((2min * speed).as<kilometer>().value == 240.0);
+  static_assert(Q<energy::joule, double>{Q<power::watts, double>{3} * 2s}.value == 6.0);
+  return 0;
+}
+
+TEST("Vector quantities") {
+  using namespace quantify::force;
+  using namespace quantify::energy;
+  using v3 = vec<double, 3>;
+
+  static_assert(is_layout_transparent_v<meter, v3>);
+  static_assert(sizeof(Q<meter, v3>) == sizeof(std::array<double, 3>));
+
+  // Conversions scale every component by the same factor
+  constexpr Q<kilometer, v3> position{{1.0, -2.0, 0.5}};
+  static_assert(position.as<meter>().value == v3{1000.0, -2000.0, 500.0});
+  static_assert((position + Q<meter, v3>{{500.0, 0.0, 0.0}}).value == v3{1.5, -2.0, 0.5});
+  static_assert((position * 2.0).value == v3{2.0, -4.0, 1.0});
+  static_assert((-position).value == v3{-1.0, 2.0, -0.5});
+  static_assert(component(position, 1).value == -2.0);
+
+  // Products with scalar quantities
+  constexpr Q<frac<meter, seconds>, v3> velocity{{3.0, 0.0, -1.0}};
+  constexpr Q<meter, v3>                displacement = velocity * Q<seconds, double>{2.0};
+  static_assert(displacement.value == v3{6.0, 0.0, -2.0});
+  static_assert((Q<minutes, double>{1.0} * velocity).as<meter>().value == v3{180.0, 0.0, -60.0});
+  static_assert((displacement / Q<milliseconds, double>{500.0}).as<frac<meter, seconds>>().value ==
+                v3{12.0, 0.0, -4.0});
+
+  // Dot and cross products take the unit of the product of their operands
+  constexpr Q<newtons, v3> force{{2.0, 3.0, 0.0}};
+  static_assert(dot(force, displacement).as<joule>().value == 12.0);
+  static_assert(dot(position, Q<meter, v3>{{1.0, 1.0, 2.0}}).as<mul<meter, meter>>().value == 0.0);
+  constexpr auto torque = cross(displacement, force);
+  static_assert(std::same_as<decltype(torque)::data_type, v3>);
+  static_assert(torque.value == v3{6.0, -4.0, 18.0});
+  static_assert(cross(Q<kilometer, v3>{{1.0, 0.0, 0.0}}, Q<meter, v3>{{0.0, 1000.0, 0.0}}).value ==
+                v3{0.0, 0.0, 1.0});
+
+  // Affine conversions offset every component by the same amount
+  constexpr Q<celsius, v3> readings{{20.0, -40.0, 100.0}};
+  static_assert(readings.as<kelvin>().value == v3{
+    Q<celsius, double>{20.0}.as<kelvin>().value,
+    Q<celsius, double>{-40.0}.as<kelvin>().value,
+    Q<celsius, double>{100.0}.as<kelvin>().value,
+  });
+  constexpr Q<fahrenheit, vec<int, 2>> forecast = Q<celsius, vec<int, 2>>{{-40, 100}};
+  static_assert(forecast.value == vec<int, 2>{-40, 212});
+  const std::vector<Q<celsius, v3>> batch{readings};
+  std::vector<Q<kelvin, v3>>        converted(batch.size());
+  if (!convert<kelvin>(std::span{batch}, std::span{converted}) ||
+      converted[0].value != readings.as<kelvin>().value) {
+    std::cerr << "[FAIL] batch conversion of vector temperatures" << std::endl;
+    return 1;
+  }
+
+  // Norms are scalar quantities
+  const Q<meter, double> length = norm(Q<meter, v3>{{3.0, 4.0, 12.0}});
+  if (length.value != 13.0 || std::abs(norm(position).as<meter>().value - 2291.287847) > 1e-6) {
+    std::cerr << "[FAIL] norm of a vector quantity" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Formulas") {
+  using namespace quantify::force;
+  using namespace quantify::energy;
+  namespace second_law = mechanics::newton::second_law;
+  namespace motion     = mechanics::uniform_motion;
+
+  // Isolating a variable is reducing the formula to an expression of the other ones
+  static_assert(std::same_as<second_law::isolate<second_law::acceleration>::expression,
+                             canonical_t<frac<second_law::force, second_law::mass>>>);
+  static_assert(std::same_as<second_law::isolate<second_law::force>::expression,
+                             canonical_t<mul<second_law::mass, second_law::acceleration>>>);
+  static_assert(std::same_as<motion::isolate<motion::time>::expression,
+                             canonical_t<frac<motion::distance, motion::speed>>>);
+
+  // Substituting every free variable evaluates the formula
+  constexpr auto a = second_law::isolate<second_law::acceleration>
+                       ::substitute<second_law::force>(Q<newtons, double>{10.0})
+                       .substitute<second_law::mass>(Q<kilograms, double>{4.0});
+  static_assert(std::same_as<decltype(a)::unit, reduce<frac<newtons, kilograms>>>);
+  static_assert(a.as<frac<meter, mul<seconds, seconds>>>().value == 2.5);
+
+  // Substitution order does not matter, and units of the same scale are mixed freely
+  constexpr auto t = motion::isolate<motion::time>
+                       ::substitute<motion::speed>(Q<frac<kilometer, hours>, double>{90.0})
+                       .substitute<motion::distance>(Q<meter, double>{450.0});
+  static_assert(t.as<seconds>().value == 18.0);
+
+  // Kernels take their variables in a fixed order and fold conversions into one constant
+  constexpr auto work = mechanics::work::isolate<mechanics::work::work>
+                          ::with<mechanics::work::distance, mechanics::work::force>;
+  static_assert(work.as<joule>(Q<kilometer, double>{2.0}, Q<newtons, double>{3.0}).value == 6000.0);
+  static_assert(work(Q<meter, double>{2.0}, Q<newtons, double>{3.0}).as<joule>().value == 6.0);
+
+  constexpr auto distance = motion::isolate<motion::distance>::with<motion::speed, motion::time>;
+  std::vector<Q<frac<meter, seconds>, double>> speeds{10.0, 20.0, 30.0};
+  std::vector<Q<minutes, double>>              times{1.0, 0.5, 2.0};
+  std::vector<Q<kilometer, double>>            out(3);
+  if (!distance.eval_into(out, speeds, times)) {
+    std::cerr << "[FAIL] formula evaluated over ranges of the same size" << std::endl;
+    return 1;
+  }
+  const double expected[] = {0.6, 0.6, 3.6};
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    if (std::abs(out[i].value - expected[i]) > 1e-12) {
+      std::cerr << "[FAIL] formula evaluated over ranges" << std::endl;
+      return 1;
+    }
+  }
+
+  const auto short_input  = distance.eval_into(out, speeds, std::span{times}.first(2));
+  const auto short_output = distance.eval_into(std::span{out}.first(2), speeds, times);
+  if (short_input || short_input.error() != std::errc::invalid_argument || short_output ||
+      short_output.error() != std::errc::invalid_argument) {
+    std::cerr << "[FAIL] formula evaluated over ranges of different sizes" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Math functions") {
+  using namespace quantify::force;
+  using namespace quantify::energy;
+
+  // Powers scale the exponents of the unit and never convert
+  static_assert(std::same_as<decltype(pow<2>(Q<meter, double>{})), Q<mul<meter, meter>, double>>);
+  static_assert(std::same_as<decltype(pow<3>(Q<frac<meter, seconds>, double>{}))::unit,
+                             frac<mul<meter, meter, meter>, mul<seconds, seconds, seconds>>>);
+  static_assert(std::same_as<decltype(pow<-1>(Q<seconds, double>{}))::unit, frac<no_unit, seconds>>);
+  static_assert(std::same_as<decltype(pow<0>(Q<meter, double>{}))::unit, no_unit>);
+  static_assert(pow<3>(Q<kilometer, int>{3}).value == 27);
+  static_assert(pow<-2>(Q<seconds, double>{4.0}).value == 0.0625);
+
+  // Roots divide them, after merging units of the same scale into the first one
+  static_assert(std::same_as<decltype(sqrt(Q<mul<meter, meter>, double>{})), Q<meter, double>>);
+  static_assert(std::same_as<decltype(sqrt(Q<mul<meter, kilometer>, double>{}))::unit, meter>);
+  static_assert(std::same_as<decltype(sqrt(Q<frac<mul<meter, meter>, mul<seconds, seconds>>, double>{}))::unit,
+                             frac<meter, seconds>>);
+  static_assert(std::same_as<decltype(cbrt(Q<mul<meter, meter, meter>, float>{})), Q<meter, float>>);
+  static_assert(std::same_as<decltype(sqrt(Q<mul<meter, meter>, int>{}))::data_type, double>);
+  static_assert(std::same_as<decltype(sqrt(Q<frac<meter, kilometer>, double>{}))::unit, no_unit>);
+
+  // Mixed units are converted into the unit of the first argument by a single factor
+  static_assert(std::same_as<decltype(hypot(Q<meter, double>{}, Q<kilometer, double>{})),
+                             Q<meter, double>>);
+  static_assert(std::same_as<decltype(fma(Q<newtons, double>{}, Q<meter, double>{}, Q<joule, double>{})),
+                             Q<mul<newtons, meter>, double>>);
+
+  // Rounding to a whole amount of a unit happens in one step, exactly for integers
+  static_assert(abs(Q<meter, double>{-2.5}).value == 2.5);
+  static_assert(abs(Q<meter, int>{-3}).value == 3);
+  static_assert(floor<seconds>(Q<milliseconds, int>{-1500}).value == -2);
+  static_assert(ceil<seconds>(Q<milliseconds, int>{1001}).value == 2);
+  static_assert(round<seconds>(Q<milliseconds, int>{1500}).value == 2);
+  static_assert(round<seconds>(Q<milliseconds, int>{-1499}).value == -1);
+  static_assert(trunc<seconds>(Q<milliseconds, int>{-1999}).value == -1);
+  static_assert(floor(Q<meter, double>{-0.5}).value == -1.0);
+  static_assert(round<kilometer>(Q<meter, double>{1500.0}).value == 2.0);
+  static_assert(fmod(Q<meter, double>{2500.0}, Q<kilometer, double>{1.0}).value == 500.0);
+
+  const auto side = sqrt(Q<mul<meter, kilometer>, double>{4.0});
+  const auto edge = cbrt(Q<mul<meter, meter, meter>, double>{27.0});
+  const auto diag = hypot(Q<meter, double>{3.0}, Q<kilometer, double>{0.004});
+  const auto work = fma(Q<newtons, double>{2.0}, Q<kilometer, double>{0.5}, Q<joule, double>{1.0});
+  if (std::abs(side.value - std::sqrt(4000.0)) > 1e-12 || std::abs(edge.value - 3.0) > 1e-12 ||
+      std::abs(diag.value - 5.0) > 1e-12 || std::abs(work.as<joule>().value - 1001.0) > 1e-12 ||
+      hypot(Q<meter, double>{1.0}, Q<meter, double>{2.0}, Q<meter, double>{2.0}).value != 3.0) {
+    std::cerr << "[FAIL] math functions" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Representation policies") {
+  // Rounding modes of integral conversions
+  static_assert(Q<millimeter, int>{1999}.as<meter>().value == 1);
+  static_assert(round_as<meter, rounding::to_nearest>(Q<millimeter, int>{1500}).value == 2);
+  static_assert(round_as<meter, rounding::to_nearest>(Q<millimeter, int>{1499}).value == 1);
+  static_assert(round_as<meter, rounding::to_nearest>(Q<millimeter, int>{-1500}).value == -2);
+  static_assert(round_as<meter, rounding::toward_infinity>(Q<millimeter, int>{1}).value == 1);
+  static_assert(round_as<meter, rounding::toward_neg_infinity>(Q<millimeter, int>{-1}).value == -1);
+  static_assert(round_as<feet, rounding::to_nearest>(Q<meter, std::int64_t>{1}).value == 3);
+  static_assert(round_as<fahrenheit, rounding::to_nearest>(Q<celsius, int>{1}).value == 34);
+  static_assert(round_as<fahrenheit, rounding::toward_zero>(Q<celsius, int>{1}).value == 33);
+
+  // Saturating integers clamp instead of overflowing
+  using sat16 = saturating<std::int16_t>;
+  static_assert(is_layout_transparent_v<meter, sat16>);
+  static_assert(Q<meter, sat16>{40}.as<millimeter>().value == sat16{32767});
+  static_assert(Q<meter, sat16>{-40}.as<millimeter>().value == sat16{-32768});
+  static_assert(Q<meter, sat16>{30}.as<millimeter>().value == sat16{30000});
+  static_assert((Q<meter, sat16>{30000} + Q<meter, sat16>{30000}).value == sat16{32767});
+  static_assert((sat16{-200} * sat16{200}).value == -32768);
+  static_assert((sat16{-32768} / sat16{-1}).value == 32767);
+  static_assert(Q<celsius, saturating<int>>{100}.as<fahrenheit>().value == saturating<int>{212});
+  // Offsets that are not integers are added before rounding, like for the built-in types
+  static_assert(Q<kelvin, saturating<int>>{300}.as<celsius>().value == saturating<int>{26});
+  static_assert(Q<kelvin, int>{300}.as<celsius>().value == 26);
+
+  // Checked integers record overflows
+  using chk32 = checked<std::int32_t>;
+  static_assert(Q<kilometer, chk32>{2}.as<meter>().value.get().value() == 2000);
+  static_assert(!Q<kilometer, chk32>{3000}.as<millimeter>().value.valid());
+  static_assert(
+    Q<kilometer, chk32>{3000}.as<millimeter>().value.get().error() == std::errc::value_too_large
+  );
+  static_assert(!(Q<kilometer, chk32>{3000}.as<millimeter>() + Q<millimeter, chk32>{1}).value.valid());
+  static_assert(!(chk32{std::numeric_limits<std::int32_t>::max()} + chk32{1}).valid());
+  static_assert(!(chk32{1} / chk32{0}).valid());
+  static_assert(chk32{2.5}.value == 2 && !chk32{1e10}.valid());
+
+  // Fixed-point numbers
+  using q16 = binary_fixed<std::int32_t, 16>;
+  using d3  = decimal_fixed<std::int64_t, 3>;
+  static_assert(is_layout_transparent_v<meter, q16>);
+  static_assert(q16{1.5} * q16{2.25} == q16{3.375} && q16{3} / q16{2} == q16{1.5});
+  static_assert(q16{1.5} * 2 == q16{3} && q16{3} / -2 == q16{-1.5});
+  static_assert(static_cast<int>(q16{2.5}) == 3 && static_cast<double>(q16{-0.25}) == -0.25);
+  // Results out of range wrap around, which would not be a constant expression if they overflowed
+  constexpr auto q16_max = q16::from_raw(std::numeric_limits<std::int32_t>::max());
+  static_assert((q16_max + q16::from_raw(1)).raw == std::numeric_limits<std::int32_t>::lowest());
+  static_assert((-(q16_max + q16::from_raw(1))).raw == std::numeric_limits<std::int32_t>::lowest());
+  static_assert((q16{32767} * 2).raw == -(1 << 17) && q16{40000}.raw == -(25536 << 16));
+  static_assert((Q<meter, q16>{q16{1.5}} + Q<millimeter, q16>{q16{500.0}}).value == q16{2});
+  static_assert(Q<millimeter, q16>{q16{1.5}}.as<meter>().value.raw == 98);
+  static_assert(static_cast<double>(Q<kilometer, d3>{d3{1.25}}.as<meter>().value) == 1250.0);
+  static_assert(Q<millimeter, d3>{d3{1.5}}.as<meter>().value == d3{0.002});
+  static_assert(Q<kelvin, d3>{300}.as<celsius>().value == d3{26.85});
+  static_assert(Q<kelvin, decimal_fixed<std::int32_t, 1>>{300}.as<celsius>().value.raw == 269);
+  static_assert(
+    Q<millimeter, decimal_fixed<std::int64_t, 3, rounding::toward_zero>>{1}.as<meter>().value.raw ==
+    1
+  );
+  return 0;
+}
+
+TEST("Reductions") {
+  using namespace quantify::force;
+  using namespace quantify::energy;
+
+  constexpr std::array<Q<millimeter, int>, 4> lengths{{{1500}, {-200}, {700}, {1000}}};
+  static_assert(sum(lengths).value == 3000);
+  static_assert(sum<meter>(lengths).value == 3);
+  static_assert(mean(lengths).value().value == 750);
+  static_assert(min_max(lengths).value().min.value == -200);
+  static_assert(min_max(lengths).value().max.value == 1500);
+  static_assert(weighted_sum(lengths, std::array{1, 2, 0, -1}).value().value == 100);
+  static_assert(weighted_sum(lengths, std::array{1, 2}).error() == std::errc::invalid_argument);
+  static_assert(!mean(std::array<Q<meter, int>, 0>{}).has_value());
+  static_assert(min_max(std::array<Q<meter, int>, 0>{}).error() == std::errc::invalid_argument);
+
+  // The dot product of forces and distances is an energy, converted once
+  constexpr std::array<Q<newtons, double>, 2> forces{{{2.0}, {3.0}}};
+  constexpr std::array<Q<meter, double>, 2>   distances{{{4.0}, {5.0}}};
+  static_assert(dot(forces, distances).value().as<joule>().value == 23.0);
+  static_assert(std::same_as<decltype(dot(forces, distances))::value_type, decltype(forces[0] * distances[0])>);
+  constexpr std::array<Q<kilometer, double>, 1> long_distances{{{2.0}}};
+  constexpr std::array<Q<meter, double>, 1>     short_distances{{{500.0}}};
+  static_assert(dot(long_distances, short_distances).value().value == 1.0);
+
+  // Ranges of different lengths are a caller bug, not a shorter dot product
+  static_assert(dot(forces, short_distances).error() == std::errc::invalid_argument);
+
+  // Pairwise summation keeps the error of a million additions close to a single rounding
+  std::vector<Q<meter, double>> values(1 << 20, Q<meter, double>{0.1});
+  const double                  exact = 0.1 * static_cast<double>(values.size());
+  double                        naive = 0.0;
+  for (const auto& q: values) {
+    naive += q.value;
+  }
+  const double error = std::abs(sum(values).value - exact);
+  if (error > 1e-9 || error * 1000.0 > std::abs(naive - exact)) {
+    std::cerr << "[FAIL] sum of 2^20 x 0.1 m is off by " << error << std::endl;
+    return 1;
+  }
+
+  for (unsigned threads = 1; threads <= 4; ++threads) {
+    const parallel_policy policy{threads};
+    if (std::abs(sum(policy, values).value - exact) > 1e-9 ||
+        std::abs(mean(policy, values).value().value - 0.1) > 1e-15 ||
+        std::abs(dot(policy, values, values).value().value - 0.01 * exact * 10.0) > 1e-9 ||
+        dot(policy, values, std::span{values}.first(3)).has_value() ||
+        min_max(policy, values).value().max.value != 0.1 ||
+        std::abs(sum<kilometer>(policy, values).value - exact / 1000.0) > 1e-12) {
+      std::cerr << "[FAIL] parallel reductions on " << threads << " threads" << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+TEST("Property tables") {
+  using namespace quantify::energy;
+  using specific_heat = frac<joule, mul<kilograms, kelvin>>;
+  using density       = frac<kilograms, mul<meter, meter, meter>>;
+
+  // Water at atmospheric pressure, rows in any order
+  const table<kelvin, specific_heat, density> water{
+    {Q<kelvin, double>{313.15}, 4179.0, 992.2},
+    {Q<kelvin, double>{293.15}, 4182.0, 998.2},
+    {Q<kelvin, double>{303.15}, 4178.0, 995.7},
+    {Q<kelvin, double>{323.15}, 4181.0, 988.0},
+  };
+  if (water.size() != 4 || water.keys()[0].value != 293.15 || water.column<1>()[3].value != 988.0) {
+    std::cerr << "[FAIL] table rows are sorted by key" << std::endl;
+    return 1;
+  }
+
+  const auto near = [](double a, double b) { return std::abs(a - b) < 1e-9; };
+
+  // Keys are converted into the unit of the table, even across scales
+  const auto [cp, rho] = water.lookup(Q<celsius, double>{25.0}).value();
+  if (!near(cp.value, 4180.0) || !near(rho.value, 996.95) ||
+      !near(water.lookup<1>(Q<millicelsius, double>{35000.0}).value().value, 993.95)) {
+    std::cerr << "[FAIL] linear lookup" << std::endl;
+    return 1;
+  }
+
+  // Keys outside of the table are clamped to its first and last rows
+  if (water.lookup<0>(Q<kelvin, double>{200.0}).value().value != 4182.0 ||
+      water.lookup<1>(Q<celsius, double>{90.0}).value().value != 988.0) {
+    std::cerr << "[FAIL] clamped lookup" << std::endl;
+    return 1;
+  }
+
+  // Cubic interpolation is exact for quadratics sampled at evenly spaced keys
+  table<seconds, meter> fall{};
+  for (int i = 0; i <= 4; ++i) {
+    fall.insert(Q<seconds, double>{static_cast<double>(i)}, Q<meter, double>{i * i * 1.0});
+  }
+  fall.insert(Q<milliseconds, double>{2000.0}, Q<kilometer, double>{0.004});
+  const Q<seconds, double> t{1.5};
+  if (fall.size() != 5 || !near(fall.lookup<0, interpolation::cubic>(t).value().value, 2.25) ||
+      !near(fall.lookup<0>(t).value().value, 2.5)) {
+    std::cerr << "[FAIL] cubic lookup" << std::endl;
+    return 1;
+  }
+
+  // Batch lookups fold the conversions of keys and results
+  const std::vector<Q<celsius, double>>                        temperatures{20.0, 25.0, 50.0};
+  std::vector<Q<specific_heat, double>>                        heats(3);
+  std::vector<Q<frac<grams, mul<meter, meter, meter>>, float>> densities(3);
+  std::vector<Q<kilometer, double>>                            heights(2);
+  if (!water.lookup_into(temperatures, heats, densities) ||
+      !fall.lookup_into<0, interpolation::cubic>(std::vector<Q<seconds, double>>{1.5, 4.0}, heights) ||
+      !near(heats[1].value, 4180.0) || std::abs(densities[0].value - 998200.0f) > 0.1f ||
+      !near(heights[0].value, 0.00225) || !near(heights[1].value, 0.016)) {
+    std::cerr << "[FAIL] batch lookup" << std::endl;
+    return 1;
+  }
+
+  // Ranges of different sizes are rejected, and nothing is written
+  heats.resize(2);
+  if (water.lookup_into(temperatures, heats, densities).error() != std::errc::invalid_argument ||
+      fall.lookup_into<0>(std::vector<Q<seconds, double>>(3), heights).error() != std::errc::invalid_argument ||
+      heights[1].value != 0.016) {
+    std::cerr << "[FAIL] batch lookup of mismatched sizes" << std::endl;
+    return 1;
+  }
+
+  // Tables with fewer than two rows have nothing to interpolate in
+  table<seconds, meter> single{};
+  if (single.lookup<0>(t).error() != std::errc::invalid_argument) {
+    std::cerr << "[FAIL] lookup in an empty table" << std::endl;
+    return 1;
+  }
+  single.insert(t, Q<meter, double>{1.0});
+  if (single.lookup(t).error() != std::errc::invalid_argument ||
+      single.lookup_into<0>(std::vector<Q<seconds, double>>{}, heights).error() !=
+        std::errc::invalid_argument) {
+    std::cerr << "[FAIL] lookup in a single-row table" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Lazy expressions") {
+  // Factors of products and quotients are folded into one constant
+  constexpr auto product = lazy::of(Q<kilometer, double>{1.5}) * Q<meter, double>{2000.0} /
+                           Q<seconds, double>{4.0};
+  static_assert(decltype(product)::factor == exact_ratio{1, 1000});
+  static_assert(std::same_as<
+                decltype(product.eval()),
+                decltype(Q<kilometer, double>{1.5} * Q<meter, double>{2000.0} / Q<seconds, double>{4.0})>);
+  static_assert(product.eval().value == 0.75);
+
+  constexpr Q<meter, double> total = lazy::of(Q<kilometer, double>{1.0}) + Q<meter, double>{500.0};
+  static_assert(total.value == 1500.0);
+  static_assert((2.0 * lazy::of(Q<meter, double>{3.0}) - Q<centimeter, double>{50.0}).as<centimeter>().value == 550.0);
+  static_assert((1.0 / lazy::of(Q<seconds, double>{4.0})).eval().value == 0.25);
+
+  // Heat balance of the "Example" test, evaluated once
+  using joules = frac<mul<kilograms, meter, meter>, mul<seconds, seconds>>;
+  const Q<kelvin, double>                               T_ci{303}, T_hi{373}, T_ho{333};
+  const Q<frac<kilograms, seconds>, double>             m_c{0.2}, m_h{0.1};
+  const Q<frac<joules, mul<kilograms, kelvin>>, double> cp_w{4178}, cp_oil{2131};
+
+  const auto                    eager = T_ci + m_h * cp_oil * (T_hi - T_ho) / (m_c * cp_w);
+  const Q<kelvin, double> fused = lazy::of(T_ci) + lazy::of(m_h) * cp_oil * (T_hi - T_ho) / (m_c * cp_w);
+  if (std::abs(eager.value - fused.value) > 1e-9) {
+    std::cerr << "[FAIL] lazy heat balance " << fused << " != " << eager << std::endl;
+    return 1;
+  }
+
+  // Element-wise formulas over ranges are fused into a single loop
+  const std::vector<Q<kilometer, double>> a{{1.0}, {2.0}, {3.0}};
+  const std::vector<Q<meter, double>>     b{{500.0}, {250.0}, {0.0}};
+  std::vector<Q<meter, double>>           out(3);
+  const auto fused_range = (lazy::of(a) + lazy::of(b)) * 2.0 + Q<centimeter, double>{100.0};
+  if (!fused_range.eval_into(out) || out[0].value != 3001.0 || out[1].value != 4501.0 ||
+      out[2].value != 6001.0) {
+    std::cerr << "[FAIL] fused range expression " << out[0] << ", " << out[1] << std::endl;
+    return 1;
+  }
+
+  // Ranges of different sizes are rejected instead of truncated
+  const std::vector<Q<meter, double>> shorter{{500.0}, {250.0}};
+  std::vector<Q<meter, double>>       untouched(3);
+  const auto mismatched_operands = (lazy::of(a) + lazy::of(shorter)).eval_into(untouched);
+  const auto mismatched_output   = fused_range.eval_into(std::span{out}.first(2));
+  if (mismatched_operands || mismatched_operands.error() != std::errc::invalid_argument ||
+      mismatched_output || mismatched_output.error() != std::errc::invalid_argument ||
+      untouched[0].value != 0.0) {
+    std::cerr << "[FAIL] fused range expression over ranges of different sizes" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Conversion instrumentation") {
+  // Conversions evaluated at compile-time are never counted
+  static_assert(Q<meter, double>{1} < Q<kilometer, double>{1});
+
+  reset_conversion_counts();
+  volatile double            sink = 0.0;
+  const Q<kilometer, double> leg{1.5};
+  Q<meter, double>           total{};
+  for (int i = 0; i < 3; ++i) {
+    total += leg;
+  }
+  std::thread{[&] {
+    Q<meter, double> other{};
+    other += leg;
+    other += leg;
+    sink = other.value;
+  }}.join();
+  const Q<celsius, double> room = Q<kelvin, double>{293.15};
+  sink = (total > Q<meter, double>{10} ? room : Q<celsius, double>{0}).value;
+  sink = fma(Q<meter, double>{2}, leg, Q<mul<meter, meter>, double>{1}).value;
+
+  const auto counts = conversion_counts();
+  if constexpr (!conversion_instrumentation_enabled) {
+    if (!counts.empty() || conversion_json() != "[]") {
+      std::cerr << "[FAIL] conversions counted without instrumentation" << std::endl;
+      return 1;
+    }
+  } else {
+    const auto count_of = [&](std::string_view from, std::string_view to, conversion_site site) {
+      const auto it = std::ranges::find_if(counts, [&](const conversion_count& c) {
+        return c.from == from && c.to == to && c.site == site;
+      });
+      return it == counts.end() ? 0 : it->count;
+    };
+    if (counts.size() != 3 || count_of("km", "m", conversion_site::compound_assignment) != 5 ||
+        count_of("K", "C", conversion_site::construction) != 1 ||
+        count_of("km", "m", conversion_site::arithmetic) != 1 ||
+        !conversion_table().contains("compound_assignment") ||
+        !conversion_json().contains(
+          R"({"from": "km", "to": "m", "site": "compound_assignment", "count": 5})"
+        )) {
+      std::cerr << "[FAIL] conversion counts:\n" << conversion_table() << std::endl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+TEST("Parsing") {
+  using namespace quantify::mass;
+  using namespace quantify::magnetic_flux_density;
+  using namespace quantify::electric_charge;
+
+  const auto near = [](double a, double b) { return std::abs(a - b) < 1e-9; };
+
+  if (parse<kelvin>("303 K").value().value != 303.0 || parse<meter, int>("2 km").value().value != 2000) {
+    std::cerr << "[FAIL] 303 K, 2 km" << std::endl;
+    return 1;
+  }
+  if (!near(parse<celsius>("303 K").value().value, 29.85)) {
+    std::cerr << "[FAIL] 303 K != " << parse<celsius>("303 K").value() << std::endl;
+    return 1;
+  }
+  if (!near(parse<frac<meter, seconds>>("36 km/hours").value().value, 10.0) ||
+      !near(parse<frac<meter, seconds>>("36 (km)/(hours)").value().value, 10.0)) {
+    std::cerr << "[FAIL] 36 km/hours != 10 (m)/(s)" << std::endl;
+    return 1;
+  }
+  if (!near(parse<mul<meter, meter>>("1.5e-3 km*m").value().value, 1.5)) {
+    std::cerr << "[FAIL] 1.5e-3 km*m != 1.5 m*m" << std::endl;
+    return 1;
+  }
+
+  // Symbols are resolved within the target's dimension
+  if (!near(parse<grams>("2 T").value().value, 2e6) || !near(parse<teslas>("2 T").value().value, 2.0) ||
+      !near(parse<coulombs>("3 mC").value().value, 3e-3) ||
+      !near(parse<celsius>("3 mC").value().value, 3e-3)) {
+    std::cerr << "[FAIL] ambiguous symbols" << std::endl;
+    return 1;
+  }
+
+  const std::pair<std::string_view, std::errc> errors[] = {
+    {"", std::errc::invalid_argument},
+    {"12", std::errc::invalid_argument},
+    {"12 s", std::errc::invalid_argument},
+    {"12 m extra", std::errc::invalid_argument},
+    {"12 C/s", std::errc::invalid_argument},
+  };
+  for (const auto& [text, error]: errors) {
+    if (parse<meter>(text).has_value() || parse<meter>(text).error() != error) {
+      std::cerr << "[FAIL] [" << text << "] should not parse" << std::endl;
+      return 1;
+    }
+  }
+  if (parse<frac<meter, seconds>>("1 C/s").has_value()) {
+    std::cerr << "[FAIL] affine units are only accepted on their own" << std::endl;
+    return 1;
+  }
+
+  // Integral quantities are converted exactly, without going through floating point
+  if (parse<millimeter, std::int64_t>("9007199254740993 m").value().value != 9007199254740993000 ||
+      parse<frac<millimeter, seconds>, std::int64_t>("-36 km/hours").value().value != -10000 ||
+      parse<celsius, int>("300 K").value().value != 26 ||
+      parse<millimeter, int>("3000000 m").error() != std::errc::result_out_of_range) {
+    std::cerr << "[FAIL] exact integral conversions" << std::endl;
+    return 1;
+  }
+
+  constexpr std::string_view lines = "12 km\n7 m";
+  Q<meter, double>           q{};
+  const auto [ptr, ec] = from_chars(lines.data(), lines.data() + lines.size(), q);
+  if (ec != std::errc{} || q.value != 12000.0 || *ptr != '\n') {
+    std::cerr << "[FAIL] from_chars stopped at [" << ptr << "]" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Dynamic quantities") {
+  using namespace quantify::mass;
+
+  static_assert(sizeof(dimension) == sizeof(std::uint64_t));
+  static_assert(dimension_of_v<kilometer> == dimension_of_v<meter>);
+  static_assert(dimension_of_v<frac<meter, seconds>> == dimension_of_v<meter> / dimension_of_v<seconds>);
+  static_assert(dimension_of_v<force::newtons> == dimension_of_v<frac<mul<kilograms, meter>, mul<seconds, seconds>>>);
+  static_assert(dimension_of_v<frac<seconds, mul<seconds, meter>>>.exponent(0) == -1);
+  static_assert(dimension_of_v<frac<meter, meter>>.dimensionless());
+  static_assert(DynamicallyDimensioned<kelvin> && !DynamicallyDimensioned<celsius>);
+
+  constexpr dynamic_quantity<double> d = Q<kilometer, double>{36.0};
+  constexpr dynamic_quantity<double> t = Q<hours, double>{1.0};
+  static_assert((d / t).as<frac<meter, seconds>>().value().value == 10.0);
+  static_assert((d + Q<meter, double>{500.0}).as<meter>().value().value == 36500.0);
+  static_assert(d > dynamic_quantity{Q<meter, double>{35999.0}});
+  static_assert(d == dynamic_quantity{Q<meter, double>{36000.0}});
+
+  // Incompatible dimensions yield an invalid quantity instead of branching
+  constexpr auto invalid = (d + t) * d;
+  static_assert(!invalid.valid() && !invalid.as<mul<meter, meter>>().has_value());
+  static_assert((d <=> t) == std::partial_ordering::unordered && d != t);
+  static_assert(d.as<seconds>().error() == std::errc::invalid_argument);
+
+  // Even when the ratio between both factors overflows 64 bits
+  constexpr dynamic_quantity<int> invalid_int{1, dimension_of_v<meter>, {0, 2}};
+  constexpr dynamic_quantity<int> huge_factor{1, dimension_of_v<meter>, {std::numeric_limits<std::int64_t>::max(), 1}};
+  static_assert(!(invalid_int + huge_factor).valid() && !(invalid_int - huge_factor).as<meter>());
+
+  // Static quantities round-trip exactly through their own unit
+  constexpr dynamic_quantity<int> i = Q<mile, int>{7};
+  static_assert(i.as<mile>().value().value == 7 && i.as<meter>().value().value == 11265);
+
+  // Factors that overflow 64 bits are folded into the value
+  dynamic_quantity<double> large = Q<radians, double>{1.0};
+  for (int k = 0; k < 4; ++k) {
+    large = large * dynamic_quantity<double>{Q<radians, double>{1.0}};
+  }
+  const auto degrees5 = large.as<mul<degrees, degrees, degrees, degrees, degrees>>();
+  if (!degrees5 || std::abs(degrees5->value / std::pow(180.0 / std::numbers::pi, 5) - 1.0) > 1e-12) {
+    std::cerr << "[FAIL] rad^5 != " << (degrees5 ? degrees5->value : 0.0) << " deg^5" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
+TEST("Wire format") {
+  static_assert(unit_wire_id_v<meter> != unit_wire_id_v<kilometer>);
+  static_assert(unit_wire_id_v<mass::ton> != unit_wire_id_v<magnetic_flux_density::teslas>);
+  static_assert(unit_wire_id_v<frac<meter, seconds>> != unit_wire_id_v<frac<seconds, meter>>);
+  static_assert(unit_wire_id_v<mul<meter, seconds>> != unit_wire_id_v<mul<meter, meter, seconds>>);
+
+  // Every catalogued unit round-trips, with an identifier of its own
+  std::stringstream       stream{};
+  wire_writer             writer{stream};
+  std::set<std::uint64_t> ids{};
+  writer.block_size = 3;
+  all_units::for_each([&]<typename U>() {
+    const std::vector<Q<U, double>> values{1.0, -2.5, 1e300, 4.0};
+    writer.write(std::span{values});
+    ids.insert(unit_wire_id_v<U>);
+  });
+  const std::vector<Q<frac<kilometer, hours>, std::int16_t>> speeds{7, -8};
+  writer.write(std::span{speeds});
+
+  if (ids.size() != all_units::size) {
+    std::cerr << "[FAIL] " << all_units::size - ids.size() << " colliding unit identifiers" << std::endl;
+    return 1;
+  }
+
+  const std::string bytes  = stream.str();
+  auto              reader = wire_stream_reader::open(stream).value();
+  int               failed = 0;
+  all_units::for_each([&]<typename U>() {
+    const auto first = reader.next().value(), second = reader.next().value();
+    const auto a = first.as<U, double>(), b = second.as<U, double>();
+    if (!a || !b || a->size() != 3 || b->size() != 1 || (*a)[2].value != 1e300 || (*b)[0].value != 4.0 ||
+        first.as<U, float>().has_value()) {
+      std::cerr << "[FAIL] " << U::symbol() << " did not round-trip" << std::endl;
+      ++failed;
+    }
+  });
+  const auto block = reader.next().value();
+  if (failed != 0 || !block.as<frac<kilometer, hours>, std::int16_t>() || block.as<frac<meter, seconds>, std::int16_t>() ||
+      block.as<frac<kilometer, hours>, std::int16_t>()->back().value != -8 || !reader.done()) {
+    std::cerr << "[FAIL] wire stream round-trip" << std::endl;
+    return 1;
+  }
+
+  // In-memory streams are viewed without copying
+  std::vector<std::uint64_t> aligned((bytes.size() + 7) / 8);
+  std::memcpy(aligned.data(), bytes.data(), bytes.size());
+  auto view = wire_reader::open(std::as_bytes(std::span{aligned}).first(bytes.size())).value();
+  while (!view.done()) {
+    if (!view.next()) {
+      std::cerr << "[FAIL] wire_reader rejected a valid stream" << std::endl;
+      return 1;
+    }
+  }
+  auto truncated = wire_reader::open(std::as_bytes(std::span{aligned}).first(bytes.size() - 8)).value();
+  while (!truncated.done() && truncated.next()) {}
+  if (wire_reader::open(std::as_bytes(std::span{aligned}).subspan(16)).error() != std::errc::illegal_byte_sequence ||
+      truncated.next().error() != std::errc::illegal_byte_sequence) {
+    std::cerr << "[FAIL] wire_reader accepted a malformed stream" << std::endl;
+    return 1;
+  }
+
+  // Empty spans write no block, and oversized blocks are rejected before allocating them
+  std::stringstream hostile{};
+  wire_writer       empty_writer{hostile};
+  empty_writer.write(std::span<const Q<meter, double>>{});
+  const wire_block_header huge{unit_wire_id_v<meter>, type_wire_id_v<double>, 0, 0, std::uint64_t{1} << 60};
+  if (hostile.str().size() != sizeof(wire_stream_header)) {
+    std::cerr << "[FAIL] wire_writer wrote a block for an empty span" << std::endl;
+    return 1;
+  }
+  hostile.write(reinterpret_cast<const char*>(&huge), sizeof(huge));
+  if (wire_stream_reader::open(hostile).value().next().error() != std::errc::value_too_large) {
+    std::cerr << "[FAIL] wire_stream_reader accepted an oversized block" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
 template <typename U>
 using value = Q<reduce<U>, double>;
 